@@ -227,6 +227,21 @@ EXPORT void __stdcall msx2_getSound(void* context, void* sound)
     memcpy(sound, result, sz);
 }
 
+// returns the display buffer of the VDP directly (the address does not change while the context is alive)
+EXPORT const void* __stdcall msx2_getDisplayBuffer(void* context)
+{
+    return ((Context*)context)->msx2->getDisplay();
+}
+
+// returns the sound buffer directly and clears it (valid until the next tick)
+EXPORT const void* __stdcall msx2_getSoundBuffer(void* context, int* size)
+{
+    size_t sz;
+    const void* result = ((Context*)context)->msx2->getSound(&sz);
+    *size = (int)sz;
+    return result;
+}
+
 EXPORT void __stdcall msx2_loadRom(void* context, const void* rom, int size, int romType)
 {
     Context* c = (Context*)context;
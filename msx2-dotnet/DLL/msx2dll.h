@@ -53,6 +53,8 @@ DLL_EXPORT int __stdcall msx2_getDisplayWidth(void* context);
 DLL_EXPORT int __stdcall msx2_getDisplayHeight(void* context);
 DLL_EXPORT int __stdcall msx2_getCurrentSoundSize(void* context);
 DLL_EXPORT void __stdcall msx2_getSound(void* context, void* sound);
+DLL_EXPORT const void* __stdcall msx2_getDisplayBuffer(void* context);
+DLL_EXPORT const void* __stdcall msx2_getSoundBuffer(void* context, int* size);
 DLL_EXPORT void __stdcall msx2_loadRom(void* context, const void* rom, int size, int romType);
 DLL_EXPORT void __stdcall msx2_ejectRom(void* context);
 DLL_EXPORT void __stdcall msx2_insertDisk(void* context, int driveId, const void* disk, int size, bool readOnly);
@@ -96,6 +96,15 @@ namespace MSX2 {
             return result;
         }
 
+        [DllImport("MSX2", EntryPoint="msx2_getDisplayBuffer")]
+        public static extern IntPtr GetDisplayBuffer(IntPtr context);
+
+        // zero-copy access to the display buffer (valid until the next Tick)
+        public static unsafe ReadOnlySpan<ushort> GetDisplaySpan(IntPtr context)
+        {
+            return new ReadOnlySpan<ushort>((void*)GetDisplayBuffer(context), GetDisplayWidth(context) * GetDisplayHeight(context));
+        }
+
         [DllImport("MSX2", EntryPoint="msx2_getDisplayWidth")]
         public static extern int GetDisplayWidth(IntPtr context);
 
@@ -116,6 +125,16 @@ namespace MSX2 {
             return result;
         }
 
+        [DllImport("MSX2", EntryPoint="msx2_getSoundBuffer")]
+        private static extern IntPtr IGetSoundBuffer(IntPtr context, out int size);
+
+        // zero-copy access to the sound buffer (valid until the next Tick)
+        public static unsafe ReadOnlySpan<byte> GetSoundSpan(IntPtr context)
+        {
+            IntPtr sound = IGetSoundBuffer(context, out int size);
+            return new ReadOnlySpan<byte>((void*)sound, size);
+        }
+
         [DllImport("MSX2", EntryPoint="msx2_loadRom")]
         private static extern void ILoadRom(IntPtr context, byte[] rom, int size, int romType);
 
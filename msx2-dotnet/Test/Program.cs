@@ -72,13 +72,17 @@ namespace Test
             Console.WriteLine($"Tick {tickCount} times");
             for (int i = 0; i < tickCount; i++) {
                 MSX2.Core.Tick(context, 0, 0, 0);
-                wave.Append(MSX2.Core.GetSound(context));
+                // both GetSound and GetSoundSpan consume the sound buffer, so use them alternately
+                wave.Append(0 == (i & 1) ? MSX2.Core.GetSound(context) : MSX2.Core.GetSoundSpan(context).ToArray());
             }
 
             int width = MSX2.Core.GetDisplayWidth(context);
             int height = MSX2.Core.GetDisplayHeight(context);
             Console.WriteLine($"Get Display ({width}x{height})");
             ushort[] display = MSX2.Core.GetDisplay(context);
+            if (!MSX2.Core.GetDisplaySpan(context).SequenceEqual(display)) {
+                Console.WriteLine("Error: GetDisplaySpan differs from GetDisplay");
+            }
 
             Console.WriteLine("Convert display to Bitmap");
             SimpleBitmap bitmap = new SimpleBitmap(width, height * 2);
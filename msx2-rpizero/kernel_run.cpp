@@ -37,7 +37,7 @@ TShutdownMode CKernel::run(void)
     auto buffer = screen.GetFrameBuffer();
     hdmiPitch = buffer->GetPitch() / sizeof(TScreenColor);
     hdmiBuffer = (uint16_t*)buffer->GetBuffer();
-    MSX2 msx2(MSX2_COLOR_MODE_RGB565);
+    MSX2 msx2(MSX2_COLOR_MODE_RGB565, false, 44100, 1);
     msx2.setupSecondaryExist(false, false, false, true);
     msx2.setup(0, 0, 0, (void*)rom_cbios_main_msx2p, 0x8000, "MAIN");
     msx2.setup(0, 0, 4, (void*)rom_cbios_logo_msx2p, 0x4000, "LOGO");
@@ -85,7 +85,7 @@ TShutdownMode CKernel::run(void)
         while (sound.PlaybackActive()) {
             scheduler.Sleep(1);
         }
-        sound.Playback(pcmData, pcmSize / 4, 2, 16);
+        sound.Playback(pcmData, pcmSize / 2, 1, 16);
     }
 
     return ShutdownHalt;
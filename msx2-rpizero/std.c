@@ -42,6 +42,11 @@ void* localtime(const signed long* _timer)
     return (void*)0;
 }
 
+void* localtime_r(const signed long* _timer, void* _result)
+{
+    return (void*)0;
+}
+
 int printf(const char* format, ...)
 {
     return 0;
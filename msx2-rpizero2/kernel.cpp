@@ -149,7 +149,7 @@ TShutdownMode CKernel::run(void)
             while (sound.PlaybackActive()) {
                 ;
             }
-            sound.Playback(pcmData, pcmSize / 4, 2, 16);
+            sound.Playback(pcmData, pcmSize / 2, 1, 16);
         }
 
         // request MSX tick to core-1
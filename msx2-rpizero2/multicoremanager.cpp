@@ -8,7 +8,7 @@ extern int msxPad1;
 extern uint16_t* hdmiBuffer;
 extern int hdmiPitch;
 extern CLogger* clogger;
-static MSX2 msx2(MSX2_COLOR_MODE_RGB565);
+static MSX2 msx2(MSX2_COLOR_MODE_RGB565, false, 44100, 1);
 
 #define DISPLAY_SIZE 568 * 240 * 2
 static unsigned short displayBuffer[2][DISPLAY_SIZE / 2];
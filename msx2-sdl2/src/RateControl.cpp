@@ -0,0 +1,83 @@
+/**
+ * micro MSX2+ - Dynamic Rate Control
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#include "RateControl.h"
+#include <stdlib.h>
+#include <string.h>
+
+RateControl::RateControl(int maxFrames, double maxDelta)
+{
+    this->maxDelta = maxDelta;
+    ratio = 1.0;
+    position = 1.0;
+    memset(last, 0, sizeof(last));
+    bufferFrames = (int)(maxFrames * (1.0 + maxDelta)) + 2;
+    buffer = (short*)malloc(bufferFrames * sizeof(last));
+    if (!buffer) {
+        bufferFrames = 0;
+    }
+}
+
+RateControl::~RateControl()
+{
+    if (buffer) free(buffer);
+}
+
+void RateControl::update(size_t fill, size_t target)
+{
+    if (!target) return;
+    // produce more samples when the queue is short and fewer when it is long
+    double delta = ((double)target - (double)fill) / target;
+    if (1.0 < delta) delta = 1.0;
+    if (delta < -1.0) delta = -1.0;
+    ratio = 1.0 + maxDelta * delta;
+}
+
+short* RateControl::process(const short* input, int frames, int channels, int* outputFrames)
+{
+    double step = 1.0 / ratio;
+    int n = 0;
+    if (frames < 1) {
+        *outputFrames = 0;
+        return buffer;
+    }
+    // interpolate linearly between frame i - 1 and frame i (frame 0 is the last frame of the previous block)
+    for (; position < frames && n < bufferFrames; position += step, n++) {
+        int i = (int)position;
+        double f = position - i;
+        for (int c = 0; c < channels; c++) {
+            int s0 = i < 1 ? last[c] : input[(i - 1) * channels + c];
+            int s1 = input[i * channels + c];
+            buffer[n * channels + c] = (short)(s0 + (s1 - s0) * f);
+        }
+    }
+    position -= frames;
+    for (int c = 0; c < channels; c++) {
+        last[c] = input[(frames - 1) * channels + c];
+    }
+    *outputFrames = n;
+    return buffer;
+}
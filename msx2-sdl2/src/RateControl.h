@@ -1,5 +1,5 @@
-/*
- * micro MSX2+ - Simple Buffer Queue
+/**
+ * micro MSX2+ - Dynamic Rate Control
  * -----------------------------------------------------------------------------
  * The MIT License (MIT)
  *
@@ -24,33 +24,32 @@
  * THE SOFTWARE.
  * -----------------------------------------------------------------------------
  */
-#ifndef INCLUDE_BUFFER_QUEUE_H
-#define INCLUDE_BUFFER_QUEUE_H
-#include <stdio.h>
+#ifndef INCLUDE_RATE_CONTROL_H
+#define INCLUDE_RATE_CONTROL_H
+#include <stddef.h>
 
-#define BUFFER_BLOCK_SIZE 8192
+// Resample the S16 output of the emulator slightly faster or slower to keep the audio queue at the target fill level
+class RateControl
+{
+  private:
+    double maxDelta; // maximum deviation of the ratio (e.g. 0.005: +/-0.5%)
+    double ratio;    // output frames per input frame
+    double position; // input position of the next output frame (0: last frame of the previous block)
+    short last[2];   // last frame of the previous block
+    short* buffer;
+    int bufferFrames;
 
-class BufferQueue {
-private:
-    void *buffer;
-    void *resultBuffer;
-    size_t size;
-    size_t cursor;
+  public:
+    RateControl(int maxFrames, double maxDelta);
+    ~RateControl();
 
-public:
-    BufferQueue(size_t iSize);
-    ~BufferQueue();
-    bool enqueue(const void *aBuffer, const size_t aSize);
-    void dequeue(void **oBuffer, size_t *oSize, size_t limit = 0xffffffff);
-    size_t getSize() {
-        return size;
-    }
-    size_t getCursor() {
-        return cursor;
-    }
-    void clear() {
-        cursor = 0;
-    }
+    // update the ratio from the fill level and the target level of the audio queue (in bytes)
+    void update(size_t fill, size_t target);
+
+    // resample the input and return the output (valid until the next call)
+    short* process(const short* input, int frames, int channels, int* outputFrames);
+
+    double getRatio() { return ratio; }
 };
 
 #endif
@@ -0,0 +1,80 @@
+/**
+ * micro MSX2+ - Lock-free Sound Ring Buffer
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#include "SoundRing.h"
+#include <stdlib.h>
+#include <string.h>
+
+SoundRing::SoundRing(size_t iSize) : head(0), tail(0), underrun(0), overrun(0)
+{
+    size = 1;
+    while (size < iSize) size <<= 1;
+    mask = size - 1;
+    buffer = (unsigned char*)malloc(size);
+    if (!buffer) {
+        size = 0;
+        mask = 0;
+    }
+}
+
+SoundRing::~SoundRing()
+{
+    if (buffer) free(buffer);
+}
+
+size_t SoundRing::write(const void* data, size_t dataSize)
+{
+    size_t h = head.load(std::memory_order_relaxed);
+    size_t space = size - (h - tail.load(std::memory_order_acquire));
+    if (space < dataSize) {
+        overrun.fetch_add(1, std::memory_order_relaxed);
+        dataSize = space;
+    }
+    size_t offset = h & mask;
+    size_t first = size - offset < dataSize ? size - offset : dataSize;
+    memcpy(&buffer[offset], data, first);
+    memcpy(buffer, (const unsigned char*)data + first, dataSize - first);
+    head.store(h + dataSize, std::memory_order_release);
+    return dataSize;
+}
+
+size_t SoundRing::read(void* output, size_t outputSize)
+{
+    size_t t = tail.load(std::memory_order_relaxed);
+    size_t fill = head.load(std::memory_order_acquire) - t;
+    size_t readSize = outputSize;
+    if (fill < readSize) {
+        underrun.fetch_add(1, std::memory_order_relaxed);
+        readSize = fill;
+        memset((unsigned char*)output + readSize, 0, outputSize - readSize);
+    }
+    size_t offset = t & mask;
+    size_t first = size - offset < readSize ? size - offset : readSize;
+    memcpy(output, &buffer[offset], first);
+    memcpy((unsigned char*)output + first, buffer, readSize - first);
+    tail.store(t + readSize, std::memory_order_release);
+    return readSize;
+}
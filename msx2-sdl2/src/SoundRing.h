@@ -0,0 +1,60 @@
+/**
+ * micro MSX2+ - Lock-free Sound Ring Buffer
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef INCLUDE_SOUND_RING_H
+#define INCLUDE_SOUND_RING_H
+#include <atomic>
+#include <stddef.h>
+
+// Fixed-capacity ring buffer for a single producer (emulation thread) and a single consumer (audio callback)
+class SoundRing
+{
+  private:
+    unsigned char* buffer;
+    size_t size; // capacity in bytes (power of 2)
+    size_t mask;
+    std::atomic<size_t> head;           // total bytes written (updated only by the producer)
+    std::atomic<size_t> tail;           // total bytes read (updated only by the consumer)
+    std::atomic<unsigned int> underrun; // number of the reads that could not be filled
+    std::atomic<unsigned int> overrun;  // number of the writes that were truncated
+
+  public:
+    SoundRing(size_t iSize);
+    ~SoundRing();
+
+    // producer: append the data and return the written size (the rest is dropped if the ring is full)
+    size_t write(const void* data, size_t dataSize);
+
+    // consumer: fill the output and return the read size (the rest is filled with silence)
+    size_t read(void* output, size_t outputSize);
+
+    size_t getSize() { return size; }
+    size_t getFill() { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire); }
+    unsigned int getUnderrun() { return underrun.load(std::memory_order_relaxed); }
+    unsigned int getOverrun() { return overrun.load(std::memory_order_relaxed); }
+};
+
+#endif
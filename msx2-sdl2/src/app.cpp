@@ -24,16 +24,20 @@
  * THE SOFTWARE.
  * -----------------------------------------------------------------------------
  */
-#include "BufferQueue.h"
+#include "RateControl.h"
 #include "SDL.h"
+#include "SoundRing.h"
 #include "msx2.hpp"
+#include "msx2scaler.hpp"
+#include <atomic>
 #include <chrono>
 #include <map>
-#include <pthread.h>
+#include <mutex>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <string>
+#include <thread>
 #include <unistd.h>
 #include <vector>
 
@@ -41,10 +45,10 @@
 #define VRAM_WIDTH 568
 #define VRAM_HEIGHT 480
 #define USE_CBIOS
+#define FRAME_READY 4 // flag of the middle frame index: rendered but not presented yet
 
-static BufferQueue soundQueue(65536);
-static pthread_mutex_t soundMutex = PTHREAD_MUTEX_INITIALIZER;
-static bool halt = false;
+static SoundRing soundRing(65536);
+static std::atomic<bool> halt(false);
 
 class MSXKeyCode
 {
@@ -127,28 +131,11 @@ void* load(const char* path, size_t* size = nullptr)
 
 static void audioCallback(void* userdata, Uint8* stream, int len)
 {
-    pthread_mutex_lock(&soundMutex);
     if (halt) {
-        pthread_mutex_unlock(&soundMutex);
-        return;
-    }
-    if (soundQueue.getCursor() < len) {
         memset(stream, 0, len);
-    } else {
-        void* buf;
-        size_t bufSize;
-        soundQueue.dequeue(&buf, &bufSize, len);
-        memcpy(stream, buf, len);
+        return;
     }
-    pthread_mutex_unlock(&soundMutex);
-    usleep(1000);
-}
-
-static inline unsigned char bit5To8(unsigned char bit5)
-{
-    bit5 <<= 3;
-    bit5 |= (bit5 & 0b11100000) >> 5;
-    return bit5;
+    soundRing.read(stream, len);
 }
 
 int main(int argc, char* argv[])
@@ -375,7 +362,7 @@ int main(int argc, char* argv[])
     int framePitch = 0;
     int offsetX = 0;
     int offsetY = 0;
-    unsigned int* frameBuffer;
+    int pixelFormat;
     if (fullScreen) {
         log("create SDL window and renderer");
         SDL_DisplayMode display;
@@ -401,12 +388,15 @@ int main(int argc, char* argv[])
             log("SDL_CreateTexture failed: %s", SDL_GetError());
             exit(-1);
         }
-        frameBuffer = (unsigned int*)malloc(framePitch * frameHeight);
-        if (!frameBuffer) {
+        // clear the borders once (only the MSX screen area is updated after this)
+        auto blank = calloc(frameHeight, framePitch);
+        if (!blank) {
             log("No memory");
             exit(-1);
         }
-        memset(frameBuffer, 0, frameWidth * frameHeight * 4);
+        SDL_UpdateTexture(texture, nullptr, blank, framePitch);
+        free(blank);
+        pixelFormat = MSX2_PIXEL_FORMAT_RGBA8888;
         SDL_ShowCursor(SDL_DISABLE);
     } else {
         log("create SDL window");
@@ -432,6 +422,7 @@ int main(int argc, char* argv[])
             log("unsupported pixel format (support only 4 bytes / pixel)");
             exit(-1);
         }
+        pixelFormat = MSX2_PIXEL_FORMAT_XRGB8888;
         SDL_UpdateWindowSurface(window);
     }
 
@@ -513,17 +504,91 @@ int main(int argc, char* argv[])
     keyMap[SDLK_DOWN] = new MSXKeyCode(8, 0b01000000);         // down cursor
     keyMap[SDLK_RIGHT] = new MSXKeyCode(8, 0b10000000);        // right cursor
 
+    // triple buffering: the emulation thread renders to its back frame, the presenter shows its front frame,
+    // and the latest rendered frame is exchanged through middle (frame index | FRAME_READY)
+    const int vramPitch = VRAM_WIDTH * 4;
+    const int displayHeight = msx2.getDisplayHeight();
+    unsigned int* frames[3];
+    for (int i = 0; i < 3; i++) {
+        frames[i] = (unsigned int*)calloc(displayHeight, vramPitch);
+        if (!frames[i]) {
+            log("No memory");
+            exit(-1);
+        }
+    }
+    std::atomic<int> middle(1);
+    std::atomic<unsigned char> msxKeyCodeMap[16];
+    for (int i = 0; i < 16; i++) {
+        msxKeyCodeMap[i] = 0;
+    }
+    std::mutex msx2Mutex; // held by the emulation thread while executing a frame
+
+    log("Start emulation thread...");
+    std::thread emulator([&]() {
+        const int frameSize = msx2.getSoundFrameSize();
+        const size_t soundTarget = obtained.samples * frameSize * 3; // keep 3 callbacks in the audio queue
+        RateControl rateControl((int)(msx2.getMaxSoundSize() / frameSize), 0.005);
+        int back = 0;
+        unsigned char keys[16];
+        bool stabled = false;
+        unsigned int underrun = 0;
+        unsigned int overrun = 0;
+        while (!halt) {
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < 16; i++) {
+                keys[i] = msxKeyCodeMap[i];
+            }
+
+            // execute emulator 1 frame (each scanline is rendered by the VDP to the back frame)
+            msx2Mutex.lock();
+            msx2.setFrameBuffer(frames[back], vramPitch, pixelFormat);
+            msx2.tickWithKeyCodeMap(0, 0, keys);
+
+            // write sound to the ring (read by the audio callback without locking)
+            // resampled slightly so that the fill level converges to soundTarget (dynamic rate control)
+            size_t pcmSize;
+            auto pcm = msx2.getSound(&pcmSize);
+            int pcmFrames;
+            rateControl.update(soundRing.getFill(), soundTarget);
+            auto resampled = rateControl.process((short*)pcm, (int)(pcmSize / frameSize), msx2.getSoundChannels(), &pcmFrames);
+            soundRing.write(resampled, pcmFrames * frameSize);
+            msx2Mutex.unlock();
+            if (soundRing.getUnderrun() != underrun || soundRing.getOverrun() != overrun) {
+                underrun = soundRing.getUnderrun();
+                overrun = soundRing.getOverrun();
+                log("warning: Sound underrun=%u, overrun=%u", underrun, overrun);
+            }
+
+            // publish the rendered frame and take the previous middle frame as the next back frame
+            back = middle.exchange(back | FRAME_READY) & 3;
+
+            // sync with the audio clock: wait until the audio device consumes the queue down to soundTarget
+            // (the deadline keeps the loop running at about 30fps if the audio device stops consuming)
+            auto us = (int)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+            auto deadline = start + std::chrono::microseconds(33333);
+            bool waited = false;
+            while (soundTarget < soundRing.getFill() && std::chrono::steady_clock::now() < deadline) {
+                usleep(1000);
+                waited = true;
+            }
+            if (waited) {
+                if (!stabled) {
+                    stabled = true;
+                    log("Frame rate stabilized by the audio clock (%dus per frame, ratio %.4f)", us, rateControl.getRatio());
+                }
+            } else if (stabled && 16667 < us) {
+                stabled = false;
+                log("warning: Frame rate is lagging (%dus per frame, %d bytes in the audio queue)", us, (int)soundRing.getFill());
+            }
+        }
+    });
+
     log("Start main loop...");
     SDL_Event event;
-    unsigned int loopCount = 0;
-    const int waitFps60[3] = {17000, 17000, 16000};
-    unsigned char msxKeyCodeMap[16];
-    memset(msxKeyCodeMap, 0, sizeof(msxKeyCodeMap));
-    bool stabled = false;
+    SDL_Rect screenRect = {offsetX, offsetY, VRAM_WIDTH, VRAM_HEIGHT};
+    int front = 2;
     bool hotKey = false;
     while (!halt) {
-        loopCount++;
-        auto start = std::chrono::system_clock::now();
         while (SDL_PollEvent(&event)) {
             if (event.type == SDL_QUIT) {
                 halt = true;
@@ -531,8 +596,11 @@ int main(int argc, char* argv[])
             } else if (event.type == SDL_KEYDOWN) {
                 if (event.key.keysym.sym == 0x400000E3) {
                     hotKey = true;
-                    memset(msxKeyCodeMap, 0, sizeof(msxKeyCodeMap));
+                    for (int i = 0; i < 16; i++) {
+                        msxKeyCodeMap[i] = 0;
+                    }
                 } else if (hotKey) {
+                    std::lock_guard<std::mutex> lock(msx2Mutex);
                     switch (event.key.keysym.sym) {
                         case SDLK_q:
                             halt = true;
@@ -585,85 +653,39 @@ int main(int argc, char* argv[])
             break;
         }
 
-        // execute emulator 1 frame
-        msx2.tickWithKeyCodeMap(0, 0, msxKeyCodeMap);
-
-        // enqueue sound
-        pthread_mutex_lock(&soundMutex);
-        size_t pcmSize;
-        auto pcm = msx2.getSound(&pcmSize);
-        soundQueue.enqueue(pcm, pcmSize);
-        pthread_mutex_unlock(&soundMutex);
+        // wait for the next frame rendered by the emulation thread
+        if (!(middle.load() & FRAME_READY)) {
+            usleep(1000);
+            continue;
+        }
+        front = middle.exchange(front) & 3;
 
-        // render graphics
-        auto msxDisplay = msx2.getDisplay();
+        // present graphics (scaled 2x vertically)
         if (fullScreen) {
-            auto pcDisplay = (unsigned int*)frameBuffer;
-            pcDisplay += offsetY * frameWidth;
-            for (int y = 0; y < VRAM_HEIGHT; y += 2) {
-                for (int x = 0; x < VRAM_WIDTH; x++) {
-                    unsigned int rgb555 = msxDisplay[x];
-                    unsigned int rgb888 = 0;
-                    rgb888 |= bit5To8((rgb555 & 0b0111110000000000) >> 10);
-                    rgb888 <<= 8;
-                    rgb888 |= bit5To8((rgb555 & 0b0000001111100000) >> 5);
-                    rgb888 <<= 8;
-                    rgb888 |= bit5To8(rgb555 & 0b0000000000011111);
-                    rgb888 <<= 8;
-                    auto offset = offsetX + x;
-                    pcDisplay[offset] = rgb888;
-                    pcDisplay[offset + frameWidth] = rgb888;
-                }
-                msxDisplay += VRAM_WIDTH;
-                pcDisplay += frameWidth * 2;
+            void* pixels;
+            int pitch;
+            if (0 == SDL_LockTexture(texture, &screenRect, &pixels, &pitch)) {
+                MSX2Scaler::render(frames[front], VRAM_WIDTH, displayHeight, vramPitch, pixels, pitch, 1, 2);
+                SDL_UnlockTexture(texture);
             }
-            SDL_UpdateTexture(texture, nullptr, frameBuffer, framePitch);
             SDL_SetRenderTarget(renderer, nullptr);
             SDL_RenderCopy(renderer, texture, nullptr, nullptr);
             SDL_RenderPresent(renderer);
         } else {
-            auto pcDisplay = (unsigned int*)windowSurface->pixels;
-            auto pitch = windowSurface->pitch / windowSurface->format->BytesPerPixel;
-            for (int y = 0; y < VRAM_HEIGHT; y += 2) {
-                for (int x = 0; x < VRAM_WIDTH; x++) {
-                    unsigned int rgb555 = msxDisplay[x];
-                    unsigned int rgb888 = 0xFF00;
-                    rgb888 |= bit5To8((rgb555 & 0b0111110000000000) >> 10);
-                    rgb888 <<= 8;
-                    rgb888 |= bit5To8((rgb555 & 0b0000001111100000) >> 5);
-                    rgb888 <<= 8;
-                    rgb888 |= bit5To8(rgb555 & 0b0000000000011111);
-                    pcDisplay[x] = rgb888;
-                }
-                msxDisplay += VRAM_WIDTH;
-                memcpy(&pcDisplay[pitch], &pcDisplay[0], VRAM_WIDTH * 4);
-                pcDisplay += pitch * 2;
-            }
+            MSX2Scaler::render(frames[front], VRAM_WIDTH, displayHeight, vramPitch, windowSurface->pixels, windowSurface->pitch, 1, 2);
             SDL_UpdateWindowSurface(window);
         }
-
-        // sync 60fps
-        std::chrono::duration<double> diff = std::chrono::system_clock::now() - start;
-        int us = (int)(diff.count() * 1000000);
-        int wait = waitFps60[loopCount % 3];
-        if (us < wait) {
-            usleep(wait - us);
-            if (!stabled) {
-                stabled = true;
-                log("Frame rate stabilized at 60 fps (%dus per frame)", us);
-            }
-        } else if (stabled) {
-            stabled = false;
-            log("warning: Frame rate is lagging (%dus per frame)", us);
-        }
     }
+    emulator.join();
 
-    log("Terminating");
+    log("Terminating (sound underrun=%u, overrun=%u)", soundRing.getUnderrun(), soundRing.getOverrun());
     SDL_CloseAudioDevice(audioDeviceId);
     if (fullScreen) {
         SDL_DestroyTexture(texture);
         SDL_DestroyRenderer(renderer);
-        free(frameBuffer);
+    }
+    for (int i = 0; i < 3; i++) {
+        free(frames[i]);
     }
     SDL_DestroyWindow(window);
     SDL_Quit();
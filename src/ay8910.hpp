@@ -27,35 +27,77 @@
 #ifndef INCLUDE_AY8910_HPP
 #define INCLUDE_AY8910_HPP
 
+#include <math.h>
 #include <string.h>
 
+#define AY8910_BLEP_PHASES 32
+#define AY8910_BLEP_TAPS 16
+#define AY8910_BLEP_CHUNK 256
+
 class AY8910
 {
   private:
-    unsigned int clock;
+    unsigned int unitClock;  // PSG clock / 8 (tone, noise and envelope counters step in this unit)
+    unsigned int sampleRate; // output sampling rate
     unsigned char regMask[16];
     unsigned int levels[32];
+    int blepKernel[AY8910_BLEP_PHASES][AY8910_BLEP_TAPS];
+    int blepBuffer[AY8910_BLEP_CHUNK + AY8910_BLEP_TAPS + 1];
 
   public:
     struct Context {
         int bobo;
         unsigned char latch;
         unsigned char reg[16];
-        unsigned int tPeriod[3];
+        int tPeriod[3];
         int tCounter[3];
         unsigned int tUp[3];
-        unsigned int nPeriod;
+        int nPeriod;
         int nCounter;
         unsigned int nUp;
-        unsigned int ePeriod;
+        int ePeriod;
         int eCounter;
-        unsigned int eState;
+        int eState;
         int eFace;
-        unsigned int eHolding;
+        unsigned int eRunning;
         unsigned int random;
-        int mix[3];
+        int output;
+        int integrator;
+        unsigned int samplePhase;
+        int blep[AY8910_BLEP_TAPS];
     } ctx;
 
+    AY8910()
+    {
+        // band-limited step as the impulse (Blackman windowed sinc) to be integrated at the output
+        const double pi = 3.14159265358979323846;
+        for (int p = 0; p < AY8910_BLEP_PHASES; p++) {
+            double kernel[AY8910_BLEP_TAPS];
+            double sum = 0;
+            for (int t = 0; t < AY8910_BLEP_TAPS; t++) {
+                double x = t - AY8910_BLEP_TAPS / 2 + 1 - (double)p / AY8910_BLEP_PHASES;
+                double w = 0.42 + 0.5 * cos(pi * x / (AY8910_BLEP_TAPS / 2)) + 0.08 * cos(2 * pi * x / (AY8910_BLEP_TAPS / 2));
+                double c = 0.9 * pi * x;
+                kernel[t] = (0 == x ? 1.0 : sin(c) / c) * (w < 0 ? 0 : w);
+                sum += kernel[t];
+            }
+            int total = 0;
+            for (int t = 0; t < AY8910_BLEP_TAPS; t++) {
+                this->blepKernel[p][t] = (int)floor(kernel[t] * 32768 / sum + 0.5);
+                total += this->blepKernel[p][t];
+            }
+            this->blepKernel[p][AY8910_BLEP_TAPS / 2 - 1] += 32768 - total;
+        }
+        this->setClock(1789773, 44100);
+        this->reset(1);
+    }
+
+    void setClock(unsigned int psgClock, unsigned int sampleRate)
+    {
+        this->unitClock = psgClock / 8;
+        this->sampleRate = sampleRate;
+    }
+
     void reset(int gain)
     {
         memset(&this->ctx, 0, sizeof(this->ctx));
@@ -64,6 +106,9 @@ class AY8910
         this->ctx.random = 0xFFFF;
         this->ctx.reg[7] = 0x80;
         this->ctx.reg[14] = 0x7F;
+        for (int i = 0; i < 3; i++) this->ctx.tCounter[i] = 1;
+        this->ctx.nCounter = 1;
+        this->ctx.eCounter = 1;
         unsigned char regMask[16] = {0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0x1F, 0xFF, 0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF};
         memcpy(this->regMask, regMask, sizeof(this->regMask));
         unsigned int levels[32] = {0, 1, 1, 1, 2, 2, 3, 4, 5, 6, 7, 9, 10, 12, 15, 18, 22, 26, 31, 37, 44, 53, 63, 75, 90, 107, 127, 151, 180, 214, 255, 255};
@@ -86,22 +131,32 @@ class AY8910
     {
         this->ctx.reg[this->ctx.latch] = value & this->regMask[this->ctx.latch];
         switch (this->ctx.latch) {
-            case 0: this->ctx.tPeriod[0] = (this->ctx.tPeriod[0] & 0xF000) | (value << 4); break;
-            case 1: this->ctx.tPeriod[0] = (this->ctx.tPeriod[0] & 0x0FF0) | (value << 12); break;
-            case 2: this->ctx.tPeriod[1] = (this->ctx.tPeriod[1] & 0xF000) | (value << 4); break;
-            case 3: this->ctx.tPeriod[1] = (this->ctx.tPeriod[1] & 0x0FF0) | (value << 12); break;
-            case 4: this->ctx.tPeriod[2] = (this->ctx.tPeriod[2] & 0xF000) | (value << 4); break;
-            case 5: this->ctx.tPeriod[2] = (this->ctx.tPeriod[2] & 0x0FF0) | (value << 12); break;
-            case 6: this->ctx.nPeriod = value << 4; break;
-            case 11:
-                this->ctx.ePeriod = this->ctx.ePeriod & 0xFF000;
-                this->ctx.ePeriod |= value << 4;
-                this->ctx.ePeriod = this->ctx.ePeriod ? this->ctx.ePeriod : 1;
+            case 0:
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5: {
+                int ch = this->ctx.latch >> 1;
+                this->ctx.tPeriod[ch] = this->ctx.reg[ch * 2] | (this->ctx.reg[ch * 2 + 1] << 8);
+                if (this->ctx.tPeriod[ch] && this->ctx.tPeriod[ch] < this->ctx.tCounter[ch]) {
+                    this->ctx.tCounter[ch] = this->ctx.tPeriod[ch];
+                }
+                break;
+            }
+            case 6:
+                this->ctx.nPeriod = this->ctx.reg[6] ? this->ctx.reg[6] : 1;
+                if (this->ctx.nPeriod < this->ctx.nCounter) {
+                    this->ctx.nCounter = this->ctx.nPeriod;
+                }
                 break;
+            case 11:
             case 12:
-                this->ctx.ePeriod = this->ctx.ePeriod & 0x00FF0;
-                this->ctx.ePeriod |= value << 12;
+                this->ctx.ePeriod = this->ctx.reg[11] | (this->ctx.reg[12] << 8);
                 this->ctx.ePeriod = this->ctx.ePeriod ? this->ctx.ePeriod : 1;
+                if (this->ctx.ePeriod < this->ctx.eCounter) {
+                    this->ctx.eCounter = this->ctx.ePeriod;
+                }
                 break;
             case 13:
                 if (value & 0b0100) {
@@ -111,71 +166,151 @@ class AY8910
                     this->ctx.eFace = -1;
                     this->ctx.eState = 0x1F;
                 }
-                this->ctx.eHolding = 1;
+                this->ctx.eCounter = this->ctx.ePeriod;
+                this->ctx.eRunning = 1;
                 break;
         }
     }
 
-    inline void tick(short* left, short* right, unsigned int cycles)
+    // render samples to the buffer (stereo: buf[0] = left, buf[1] = right, ...)
+    inline void render(short* buf, int samples, int channels = 2)
+    {
+        while (0 < samples) {
+            int n = samples < AY8910_BLEP_CHUNK ? samples : AY8910_BLEP_CHUNK;
+            this->renderChunk(buf, n, channels);
+            buf += n * channels;
+            samples -= n;
+        }
+    }
+
+  private:
+    inline void renderChunk(short* buf, int samples, int channels)
     {
-        if (this->ctx.eHolding) {
-            this->ctx.eCounter += cycles;
-            while (0 < this->ctx.eCounter) {
-                this->ctx.eCounter -= this->ctx.ePeriod;
-                this->ctx.eState += this->ctx.eFace;
-                if (this->ctx.eState & 0b00100000) {
-                    switch (this->ctx.reg[13]) {
-                        case 8:
-                        case 12:
-                            this->ctx.eState = this->ctx.eFace == 1 ? 0 : 0x1F;
-                            break;
-                        case 10:
-                        case 14:
-                            this->ctx.eFace = -this->ctx.eFace;
-                            this->ctx.eState = this->ctx.eFace == 1 ? 0 : 0x1F;
-                            break;
-                        case 11:
-                        case 15:
-                            this->ctx.eState = this->ctx.eFace == 1 ? 0 : 0x1F;
-                            this->ctx.eHolding = 1;
-                            this->ctx.eCounter = 0;
-                            break;
-                        case 9:
-                        case 13:
-                            this->ctx.eFace = -this->ctx.eFace;
-                            this->ctx.eState = this->ctx.eFace == 1 ? 0 : 0x1F;
-                            this->ctx.eHolding = 1;
-                            this->ctx.eCounter = 0;
-                            break;
-                        default:
-                            this->ctx.eState = 0;
-                            this->ctx.eHolding = 1;
-                            this->ctx.eCounter = 0;
-                    }
+        int* acc = this->blepBuffer;
+        memcpy(acc, this->ctx.blep, sizeof(this->ctx.blep));
+        memset(&acc[AY8910_BLEP_TAPS], 0, sizeof(int) * (samples + 1));
+
+        // the level changed by writing the registers takes effect from the beginning of this chunk
+        this->updateOutput(acc, 0);
+
+        // step the counters from event to event in closed form
+        long long phase = this->ctx.samplePhase;
+        long long total = phase + (long long)samples * this->unitClock;
+        int units = (int)(total / this->sampleRate);
+        this->ctx.samplePhase = (unsigned int)(total % this->sampleRate);
+        int elapsed = 0;
+        while (elapsed < units) {
+            int mixer = this->ctx.reg[7];
+            int step = units - elapsed;
+            for (int ch = 0; ch < 3; ch++) {
+                if (this->ctx.tPeriod[ch] && 0 == (mixer & (1 << ch)) && this->ctx.tCounter[ch] < step) {
+                    step = this->ctx.tCounter[ch];
                 }
             }
-        }
-        if (this->ctx.nPeriod) {
-            this->ctx.nCounter += cycles;
-            while (0 <= this->ctx.nCounter) {
-                this->ctx.nCounter -= this->ctx.nPeriod;
+            if (0x38 != (mixer & 0x38) && this->ctx.nCounter < step) {
+                step = this->ctx.nCounter;
+            }
+            if (this->ctx.eRunning && this->isEnvelopeUsed() && this->ctx.eCounter < step) {
+                step = this->ctx.eCounter;
+            }
+            elapsed += step;
+            for (int ch = 0; ch < 3; ch++) {
+                if (this->ctx.tPeriod[ch]) {
+                    int count = this->advance(&this->ctx.tCounter[ch], this->ctx.tPeriod[ch], step);
+                    this->ctx.tUp[ch] ^= count & 1;
+                }
+            }
+            for (int count = this->advance(&this->ctx.nCounter, this->ctx.nPeriod ? this->ctx.nPeriod : 1, step); 0 < count; count--) {
                 this->ctx.nUp = this->getRandom();
             }
-        } else {
-            this->ctx.nUp = this->getRandom();
+            if (this->ctx.eRunning) {
+                this->stepEnvelope(this->advance(&this->ctx.eCounter, this->ctx.ePeriod, step));
+            }
+            long long time = (long long)elapsed * this->sampleRate - phase;
+            this->updateOutput(acc, (int)((time < 0 ? 0 : time) * AY8910_BLEP_PHASES / this->unitClock));
+        }
+
+        // integrate the band-limited steps
+        int integrator = this->ctx.integrator;
+        for (int i = 0; i < samples; i++, buf += channels) {
+            integrator += acc[i];
+            int mix = integrator >> 15;
+            if (32767 < mix)
+                mix = 32767;
+            else if (mix < -32768)
+                mix = -32768;
+            buf[0] = (short)mix;
+            buf[channels - 1] = buf[0];
         }
-        int mix = this->getOutputMix(0, this->ctx.reg[7], cycles);
-        mix += this->getOutputMix(1, this->ctx.reg[7] >> 1, cycles);
-        mix += this->getOutputMix(2, this->ctx.reg[7] >> 2, cycles);
-        if (32767 < mix)
-            mix = 32767;
-        else if (mix < -32768)
-            mix = -32768;
-        *left = (short)mix;
-        *right = *left;
+        this->ctx.integrator = integrator;
+        memcpy(this->ctx.blep, &acc[samples], sizeof(this->ctx.blep));
+    }
+
+    // decrease the counter by step units and returns the number of the periods expired
+    inline int advance(int* counter, int period, int step)
+    {
+        *counter -= step;
+        if (0 < *counter) return 0;
+        int count = 1 + (-*counter) / period;
+        *counter += count * period;
+        return count;
+    }
+
+    inline bool isEnvelopeUsed()
+    {
+        return (this->ctx.reg[8] | this->ctx.reg[9] | this->ctx.reg[10]) & 0x10;
+    }
+
+    inline void stepEnvelope(int count)
+    {
+        while (0 < count && this->ctx.eRunning) {
+            int remain = this->ctx.eFace == 1 ? 0x1F - this->ctx.eState : this->ctx.eState;
+            if (count <= remain) {
+                this->ctx.eState += this->ctx.eFace * count;
+                return;
+            }
+            count -= remain + 1;
+            int shape = this->ctx.reg[13];
+            int last = this->ctx.eFace == 1 ? 0x1F : 0;
+            if (0 == (shape & 0b1000)) {
+                this->ctx.eState = 0;
+                this->ctx.eRunning = 0;
+            } else if (shape & 0b0001) {
+                this->ctx.eState = shape & 0b0010 ? 0x1F - last : last;
+                this->ctx.eRunning = 0;
+            } else if (shape & 0b0010) {
+                this->ctx.eFace = -this->ctx.eFace;
+                this->ctx.eState = last;
+            } else {
+                this->ctx.eState = 0x1F - last;
+            }
+        }
+    }
+
+    inline void updateOutput(int* acc, int position)
+    {
+        int output = this->getLevel(0) + this->getLevel(1) + this->getLevel(2);
+        int delta = output - this->ctx.output;
+        if (delta) {
+            this->ctx.output = output;
+            const int* kernel = this->blepKernel[position % AY8910_BLEP_PHASES];
+            acc += position / AY8910_BLEP_PHASES;
+            for (int i = 0; i < AY8910_BLEP_TAPS; i++) {
+                acc[i] += kernel[i] * delta;
+            }
+        }
+    }
+
+    inline int getLevel(int ch)
+    {
+        unsigned int mask = this->ctx.reg[7] >> ch;
+        if (((mask & 0x01) || this->ctx.tUp[ch] || 0 == this->ctx.tPeriod[ch]) && ((mask & 0x08) || this->ctx.nUp)) {
+            unsigned int volume = this->ctx.reg[8 + ch];
+            return volume & 0x10 ? this->levels[this->ctx.eState] : this->levels[(volume & 0x0F) << 1];
+        }
+        return 0;
     }
 
-  private:
     inline int getRandom()
     {
         if (this->ctx.random & 1) {
@@ -187,27 +322,6 @@ class AY8910
             return 0;
         }
     }
-
-    inline int getOutputMix(int ch, unsigned int mask, unsigned int cycles)
-    {
-        unsigned int volume;
-        int mix = this->ctx.mix[ch];
-        if (this->ctx.tPeriod[ch]) {
-            this->ctx.tCounter[ch] += cycles;
-            while (0 <= this->ctx.tCounter[ch]) {
-                this->ctx.tCounter[ch] -= this->ctx.tPeriod[ch];
-                this->ctx.tUp[ch] ^= 1;
-            }
-        } else
-            this->ctx.tUp[ch] = 1;
-        if (((mask & 0x01) || this->ctx.tUp[ch]) && ((mask & 0x08) || this->ctx.nUp)) {
-            volume = this->ctx.reg[8 + ch] << 1;
-            this->ctx.mix[ch] = volume & 0x20 ? this->levels[this->ctx.eState] : this->levels[volume & 0x1F];
-        } else {
-            this->ctx.mix[ch] >>= 1;
-        }
-        return (mix + this->ctx.mix[ch]) >> 1;
-    }
 };
 
 #endif // INCLUDE_AY8910_HPP
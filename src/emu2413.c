@@ -1044,16 +1044,14 @@ static void update_output(OPLL *opll) {
   update_noise(opll, 2);
 }
 
-static OPLL_RateConv *conv;
-
 INLINE static void mix_output(OPLL *opll) {
   int16_t out = 0;
   int i;
   for (i = 0; i < 14; i++) {
     out += opll->ch_out[i];
   }
-  if (conv) {
-    OPLL_RateConv_putData(conv, 0, out);
+  if (opll->conv) {
+    OPLL_RateConv_putData(opll->conv, 0, out);
   } else {
     opll->mix_out[0] = out;
   }
@@ -1069,9 +1067,9 @@ INLINE static void mix_output_stereo(OPLL *opll) {
     if (opll->pan[i] & 1)
       out[1] += (int16_t)(opll->ch_out[i] * opll->pan_fine[i][1]);
   }
-  if (conv) {
-    OPLL_RateConv_putData(conv, 0, out[0]);
-    OPLL_RateConv_putData(conv, 1, out[1]);
+  if (opll->conv) {
+    OPLL_RateConv_putData(opll->conv, 0, out[0]);
+    OPLL_RateConv_putData(opll->conv, 1, out[1]);
   }
 }
 
@@ -1099,10 +1097,7 @@ OPLL *OPLL_new(uint32_t clk, uint32_t rate) {
   opll->clk = clk;
   opll->rate = rate;
   opll->mask = 0;
-    if (conv) {
-        OPLL_RateConv_delete(conv);
-        conv = NULL;
-    }
+  opll->conv = NULL;
   opll->mix_out[0] = 0;
   opll->mix_out[1] = 0;
 
@@ -1113,9 +1108,9 @@ OPLL *OPLL_new(uint32_t clk, uint32_t rate) {
 }
 
 void OPLL_delete(OPLL *opll) {
-  if (conv) {
-    OPLL_RateConv_delete(conv);
-    conv = NULL;
+  if (opll->conv) {
+    OPLL_RateConv_delete(opll->conv);
+    opll->conv = NULL;
   }
   free(opll);
 }
@@ -1128,17 +1123,17 @@ static void reset_rate_conversion_params(OPLL *opll) {
   opll->out_step = f_inp;
   opll->inp_step = f_out;
 
-  if (conv) {
-    OPLL_RateConv_delete(conv);
-    conv = NULL;
+  if (opll->conv) {
+    OPLL_RateConv_delete(opll->conv);
+    opll->conv = NULL;
   }
 
   if (floor(f_inp) != f_out && floor(f_inp + 0.5) != f_out) {
-    conv = OPLL_RateConv_new(f_inp, f_out, 2);
+    opll->conv = OPLL_RateConv_new(f_inp, f_out, 2);
   }
 
-  if (conv) {
-    OPLL_RateConv_reset(conv);
+  if (opll->conv) {
+    OPLL_RateConv_reset(opll->conv);
   }
 }
 
@@ -1465,8 +1460,8 @@ int16_t OPLL_calc(OPLL *opll) {
     mix_output(opll);
   }
   opll->out_time -= opll->out_step;
-  if (conv) {
-    opll->mix_out[0] = OPLL_RateConv_getData(conv, 0);
+  if (opll->conv) {
+    opll->mix_out[0] = OPLL_RateConv_getData(opll->conv, 0);
   }
   return opll->mix_out[0];
 }
@@ -1478,9 +1473,9 @@ void OPLL_calcStereo(OPLL *opll, int32_t out[2]) {
     mix_output_stereo(opll);
   }
   opll->out_time -= opll->out_step;
-  if (conv) {
-    out[0] = OPLL_RateConv_getData(conv, 0);
-    out[1] = OPLL_RateConv_getData(conv, 1);
+  if (opll->conv) {
+    out[0] = OPLL_RateConv_getData(opll->conv, 0);
+    out[1] = OPLL_RateConv_getData(opll->conv, 1);
   } else {
     out[0] = opll->mix_out[0];
     out[1] = opll->mix_out[1];
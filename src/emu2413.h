@@ -125,6 +125,8 @@ typedef struct __OPLL {
   int16_t ch_out[14];
 
   int16_t mix_out[2];
+
+  OPLL_RateConv *conv;
 } OPLL;
 
 OPLL *OPLL_new(uint32_t clk, uint32_t rate);
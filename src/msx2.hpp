@@ -39,36 +39,74 @@
 #include "tc8566af.hpp"
 #include "v9958.hpp"
 #include "z80.hpp"
+#include <stddef.h>
 
 class MSX2
 {
   private:
     const int CPU_CLOCK = 3584160;
     const int VDP_CLOCK = 21504960;
-    const int PSG_CLOCK = 44100;
+    int soundSampleRate;
+    int soundChannels;
+    int soundFormat;
     class InternalBuffer
     {
       public:
-        short soundBuffer[16384];
-        unsigned short soundBufferCursor;
+        alignas(16) unsigned char soundBuffer[32768];
+        short soundScratch[512];
+        int soundBufferCursor; // number of the sample frames in soundBuffer
+        int soundPending;
         char* quickSaveBuffer;
         char* quickSaveBufferCompressed;
         size_t quickSaveBufferPtr;
         size_t quickSaveBufferHeapSize;
+        unsigned char* snapshotBaseRAM;
+        unsigned char* snapshotBaseVDP;
 
         InternalBuffer()
         {
             memset(this->soundBuffer, 0, sizeof(this->soundBuffer));
             this->soundBufferCursor = 0;
+            this->soundPending = 0;
             this->quickSaveBuffer = nullptr;
             this->quickSaveBufferCompressed = nullptr;
             this->quickSaveBufferPtr = 0;
             this->quickSaveBufferHeapSize = 0;
+            this->snapshotBaseRAM = nullptr;
+            this->snapshotBaseVDP = nullptr;
         }
 
         ~InternalBuffer()
         {
             this->safeReleaseQuickSaveBuffer();
+            this->safeReleaseSnapshotBase();
+        }
+
+        void safeReleaseSnapshotBase()
+        {
+            if (this->snapshotBaseRAM) {
+                free(this->snapshotBaseRAM);
+                this->snapshotBaseRAM = nullptr;
+            }
+            if (this->snapshotBaseVDP) {
+                free(this->snapshotBaseVDP);
+                this->snapshotBaseVDP = nullptr;
+            }
+        }
+
+        bool allocateSnapshotBase(size_t ramSize, size_t vdpSize)
+        {
+            if (!this->snapshotBaseRAM) {
+                this->snapshotBaseRAM = (unsigned char*)malloc(ramSize);
+            }
+            if (!this->snapshotBaseVDP) {
+                this->snapshotBaseVDP = (unsigned char*)malloc(vdpSize);
+            }
+            if (!this->snapshotBaseRAM || !this->snapshotBaseVDP) {
+                this->safeReleaseSnapshotBase();
+                return false;
+            }
+            return true;
         }
 
         void safeReleaseQuickSaveBuffer()
@@ -86,7 +124,7 @@ class MSX2
 
         bool allocateQuickSaveBuffer(size_t size)
         {
-            if (size == this->quickSaveBufferHeapSize) {
+            if (size <= this->quickSaveBufferHeapSize) {
                 return true;
             }
             this->safeReleaseQuickSaveBuffer();
@@ -106,6 +144,7 @@ class MSX2
 
     InternalBuffer* ib;
     bool debug;
+    int logSeqno;
 
     struct KeyCode {
         int num;
@@ -141,7 +180,15 @@ class MSX2
     }
 
   public:
-    Z80* cpu;
+    // Memory and I/O access of the CPU (called directly from the Z80 operand handlers)
+    struct CPUBus {
+        static inline unsigned char read(void* arg, unsigned short addr) { return ((MSX2*)arg)->mmu->read(addr); }
+        static inline void write(void* arg, unsigned short addr, unsigned char value) { ((MSX2*)arg)->mmu->write(addr, value); }
+        static inline unsigned char in(void* arg, unsigned short port) { return ((MSX2*)arg)->inPort((unsigned char)port); }
+        static inline void out(void* arg, unsigned short port, unsigned char value) { ((MSX2*)arg)->outPort((unsigned char)port, value); }
+    };
+
+    Z80Template<CPUBus>* cpu;
     MSX2MMU* mmu;
     V9958* vdp;
     AY8910* psg;
@@ -178,28 +225,33 @@ class MSX2
         delete this->ib;
     }
 
-    MSX2(int colorMode, bool ym2413Enabled = false)
+    MSX2(int colorMode, bool ym2413Enabled = false, int sampleRate = 44100, int soundChannels = 2, int soundFormat = MSX2_SOUND_FORMAT_S16)
     {
 #ifdef DEBUG
         this->debug = true;
 #else
         this->debug = false;
 #endif
+        this->logSeqno = 0;
+        this->soundSampleRate = sampleRate;
+        this->soundChannels = 1 == soundChannels ? 1 : 2;
+        this->soundFormat = soundFormat;
         memset(&this->keyAssign, 0, sizeof(this->keyAssign));
         this->ib = new InternalBuffer();
         this->mmu = new MSX2MMU();
         this->vdp = new V9958();
         this->psg = new AY8910();
+        this->psg->setClock(CPU_CLOCK / 2, this->soundSampleRate);
         this->clock = new MSX2Clock();
         this->kanji = new MSX2Kanji();
-        this->cpu = new Z80([](void* arg, unsigned short addr) { return ((MSX2*)arg)->mmu->read(addr); }, [](void* arg, unsigned short addr, unsigned char value) { ((MSX2*)arg)->mmu->write(addr, value); }, [](void* arg, unsigned short port) { return ((MSX2*)arg)->inPort((unsigned char)port); }, [](void* arg, unsigned short port, unsigned char value) { ((MSX2*)arg)->outPort((unsigned char)port, value); }, this, false);
+        this->cpu = new Z80Template<CPUBus>(this);
         this->cpu->wtc.fetch = 1;
         this->cpu->wtc.fetchM = 1;
         this->scc = nullptr;
 #ifndef MSX2_REMOVE_OPLL
         if (ym2413Enabled) {
             this->putlog("create YM2413 instance");
-            this->ym2413 = OPLL_new(CPU_CLOCK, 44100);
+            this->ym2413 = OPLL_new(CPU_CLOCK, this->soundSampleRate);
         } else {
             this->ym2413 = nullptr;
         }
@@ -210,7 +262,7 @@ class MSX2
             //((MSX2*)arg)->cpu->resetDebugMessage();
             ((MSX2*)arg)->cpu->generateIRQ(0x07); }, [](void* arg) { ((MSX2*)arg)->cpu->cancelIRQ(); }, [](void* arg) { ((MSX2*)arg)->cpu->requestBreak(); });
         this->mmu->setupCallbacks(
-            this, [](void* arg, unsigned short addr) { return ((MSX2*)arg)->scc->read(addr); }, [](void* arg, unsigned short addr, unsigned char value) { ((MSX2*)arg)->scc->write(addr, value); }, [](void* arg, unsigned short addr) {
+            this, [](void* arg, unsigned short addr) { return ((MSX2*)arg)->scc->read(addr); }, [](void* arg, unsigned short addr, unsigned char value) { ((MSX2*)arg)->renderSound(); ((MSX2*)arg)->scc->write(addr, value); }, [](void* arg, unsigned short addr) {
             switch (addr) {
                 case 0x3FFA: return ((MSX2*)arg)->fdc->read(4);
                 case 0x3FFB: return ((MSX2*)arg)->fdc->read(5);
@@ -224,8 +276,8 @@ class MSX2
             } }, [](void* arg, unsigned short addr, unsigned char value) {
             switch (addr) {
 #ifndef MSX2_REMOVE_OPLL
-                case 0x3FF4: OPLL_writeIO(((MSX2*)arg)->ym2413, 0, value); break;
-                case 0x3FF5: OPLL_writeIO(((MSX2*)arg)->ym2413, 1, value); break;
+                case 0x3FF4: ((MSX2*)arg)->renderSound(); OPLL_writeIO(((MSX2*)arg)->ym2413, 0, value); break;
+                case 0x3FF5: ((MSX2*)arg)->renderSound(); OPLL_writeIO(((MSX2*)arg)->ym2413, 1, value); break;
 #endif
             } });
         this->fdc = nullptr;
@@ -385,6 +437,7 @@ class MSX2
     {
         memset(this->ib->soundBuffer, 0, sizeof(this->ib->soundBuffer));
         this->ib->soundBufferCursor = 0;
+        this->ib->soundPending = 0;
         memset(&this->cpu->reg, 0, sizeof(this->cpu->reg));
         memset(&this->cpu->reg.pair, 0xFF, sizeof(this->cpu->reg.pair));
         memset(&this->cpu->reg.back, 0xFF, sizeof(this->cpu->reg.back));
@@ -409,7 +462,6 @@ class MSX2
     void putlog(const char* fmt, ...)
     {
         if (!this->debug) return;
-        static int seqno = 0;
         char buf[256];
         va_list args;
         va_start(args, fmt);
@@ -423,7 +475,7 @@ class MSX2
         } else {
             snprintf(addr, sizeof(addr), "[PC=%04X,SP=%04X]", this->cpu->reg.PC, this->cpu->reg.SP);
         }
-        printf("%7d %s %d-%d:%d-%d:%d-%d:%d-%d F:%02d,V:%03d %s\n", ++seqno, addr,
+        printf("%7d %s %d-%d:%d-%d:%d-%d:%d-%d F:%02d,V:%03d %s\n", ++this->logSeqno, addr,
                this->mmu->ctx.pri[0], this->mmu->ctx.sec[0],
                this->mmu->ctx.pri[1], this->mmu->ctx.sec[1],
                this->mmu->ctx.pri[2], this->mmu->ctx.sec[2],
@@ -432,6 +484,21 @@ class MSX2
                this->vdp->ctx.countV, buf);
     }
 
+    void setLazyRendering(bool lazyRendering)
+    {
+        this->vdp->lazyRendering = lazyRendering;
+    }
+
+    void setSkipRendering(bool skipRendering)
+    {
+        this->vdp->skipRendering = skipRendering;
+    }
+
+    void setHalfHorizontal(bool halfHorizontal)
+    {
+        this->vdp->setHalfHorizontal(halfHorizontal);
+    }
+
     void loadFont(const void* font, size_t fontSize)
     {
         this->kanji->loadFont(font, fontSize);
@@ -453,7 +520,7 @@ class MSX2
 #ifndef MSX2_REMOVE_OPLL
             if (!this->ym2413) {
                 this->putlog("create YM2413 instance");
-                this->ym2413 = OPLL_new(CPU_CLOCK, 44100);
+                this->ym2413 = OPLL_new(CPU_CLOCK, this->soundSampleRate);
             }
 #endif
         } else if (0 == strcmp(label, "DISK")) {
@@ -478,6 +545,7 @@ class MSX2
             if (!this->scc) {
                 this->putlog("create SCC instance");
                 this->scc = new SCC();
+                this->scc->setClock(CPU_CLOCK, this->soundSampleRate);
                 this->scc->enabled = true;
             }
         } else if (this->scc) {
@@ -523,6 +591,8 @@ class MSX2
         this->ctx.key = key;
         this->keyCodeMap = nullptr;
         this->cpu->execute(0x7FFFFFFF);
+        this->vdp->syncCommand();
+        this->renderSound();
     }
 
     void tickWithKeyCodeMap(unsigned char pad1, unsigned char pad2, unsigned char* keyCodeMap)
@@ -531,6 +601,8 @@ class MSX2
         this->ctx.key = 0;
         this->keyCodeMap = keyCodeMap;
         this->cpu->execute(0x7FFFFFFF);
+        this->vdp->syncCommand();
+        this->renderSound();
     }
 
     size_t getMaxSoundSize()
@@ -540,51 +612,37 @@ class MSX2
 
     size_t getCurrentSoundSize()
     {
-        return this->ib->soundBufferCursor * 2;
+        this->renderSound();
+        return this->ib->soundBufferCursor * this->getSoundFrameSize();
     }
 
     void* getSound(size_t* soundSize)
     {
-        *soundSize = this->ib->soundBufferCursor * 2;
+        this->renderSound();
+        *soundSize = this->ib->soundBufferCursor * this->getSoundFrameSize();
         this->ib->soundBufferCursor = 0;
         return this->ib->soundBuffer;
     }
 
+    inline int getSoundSampleRate() { return this->soundSampleRate; }
+    inline int getSoundChannels() { return this->soundChannels; }
+    inline int getSoundFormat() { return this->soundFormat; }
+    inline int getSoundFrameSize() { return this->soundChannels * (MSX2_SOUND_FORMAT_F32 == this->soundFormat ? 4 : 2); }
+
     inline unsigned short* getDisplay() { return this->vdp->display; }
     inline int getDisplayWidth() { return vdp->displayWidth(); }
     inline int getDisplayHeight() { return 240; }
 
+    // convert each rendered scanline of the display to the external framebuffer in the specified MSX2_PIXEL_FORMAT_* (nullptr: detach)
+    inline void setFrameBuffer(void* pixels, int pitch, int format) { this->vdp->setOutputBuffer(pixels, pitch, format); }
+
     inline void consumeClock(int cpuClocks)
     {
-        // Asynchronous with PSG/SCC
-        this->psg->ctx.bobo += cpuClocks * this->PSG_CLOCK;
+        // Asynchronous with PSG/SCC/OPLL (the samples are rendered by renderSound)
+        this->psg->ctx.bobo += cpuClocks * this->soundSampleRate;
         while (0 < this->psg->ctx.bobo) {
             this->psg->ctx.bobo -= this->CPU_CLOCK;
-            this->psg->tick(&this->ib->soundBuffer[this->ib->soundBufferCursor], &this->ib->soundBuffer[this->ib->soundBufferCursor + 1], 81);
-            if (this->scc) {
-                this->scc->tick(&this->ib->soundBuffer[this->ib->soundBufferCursor], &this->ib->soundBuffer[this->ib->soundBufferCursor + 1], 81);
-            }
-#ifndef MSX2_REMOVE_OPLL
-            if (this->ym2413) {
-                auto opllWav = OPLL_calc(this->ym2413);
-                int l = this->ib->soundBuffer[this->ib->soundBufferCursor];
-                int r = this->ib->soundBuffer[this->ib->soundBufferCursor + 1];
-                l += opllWav;
-                r += opllWav;
-                if (32767 < l)
-                    l = 32767;
-                else if (l < -32768)
-                    l = -32768;
-                if (32767 < r)
-                    r = 32767;
-                else if (r < -32768)
-                    r = -32768;
-                this->ib->soundBuffer[this->ib->soundBufferCursor] = (short)l;
-                this->ib->soundBuffer[this->ib->soundBufferCursor + 1] = (short)r;
-            }
-#endif
-            this->ib->soundBufferCursor += 2;
-            this->ib->soundBufferCursor &= sizeof(this->ib->soundBuffer) - 1;
+            this->ib->soundPending++;
         }
         // Asynchronous with VDP
         this->vdp->ctx.bobo += cpuClocks * VDP_CLOCK;
@@ -599,6 +657,72 @@ class MSX2
         }
     }
 
+    // Render the pending samples (counted by consumeClock) to the sound buffer.
+    // This must be called before writing to a sound chip register so that the register
+    // update is applied from the same sample timing as the per-sample synthesis.
+    void renderSound()
+    {
+        const bool f32 = MSX2_SOUND_FORMAT_F32 == this->soundFormat;
+        const int frameSize = this->getSoundFrameSize();
+        const int bufferFrames = (int)(sizeof(this->ib->soundBuffer) / frameSize);
+        while (0 < this->ib->soundPending) {
+            int samples = bufferFrames - this->ib->soundBufferCursor;
+            if (this->ib->soundPending < samples) {
+                samples = this->ib->soundPending;
+            }
+            // float32 is converted from the int16 samples rendered in the scratch buffer
+            if (f32 && 256 < samples) {
+                samples = 256;
+            }
+            void* ptr = &this->ib->soundBuffer[this->ib->soundBufferCursor * frameSize];
+            short* buf = f32 ? this->ib->soundScratch : (short*)ptr;
+            this->psg->render(buf, samples, this->soundChannels);
+            if (this->scc) {
+                this->scc->render(buf, samples, this->soundChannels);
+            }
+#ifndef MSX2_REMOVE_OPLL
+            if (this->ym2413) {
+                this->renderOPLL(buf, samples);
+            }
+#endif
+            if (f32) {
+                float* dst = (float*)ptr;
+                for (int i = 0; i < samples * this->soundChannels; i++) {
+                    dst[i] = buf[i] / 32768.0f;
+                }
+            }
+            this->ib->soundPending -= samples;
+            this->ib->soundBufferCursor += samples;
+            this->ib->soundBufferCursor &= bufferFrames - 1;
+        }
+    }
+
+#ifndef MSX2_REMOVE_OPLL
+    inline void renderOPLL(short* buf, int samples)
+    {
+        short wav[256];
+        while (0 < samples) {
+            int n = samples < 256 ? samples : 256;
+            for (int i = 0; i < n; i++) {
+                wav[i] = OPLL_calc(this->ym2413);
+            }
+            if (1 == this->soundChannels) {
+                for (int i = 0; i < n; i++) {
+                    int w = buf[i] + wav[i];
+                    buf[i] = (short)(32767 < w ? 32767 : (w < -32768 ? -32768 : w));
+                }
+            } else {
+                for (int i = 0; i < n * 2; i++) {
+                    int w = buf[i] + wav[i / 2];
+                    buf[i] = (short)(32767 < w ? 32767 : (w < -32768 ? -32768 : w));
+                }
+            }
+            buf += n * this->soundChannels;
+            samples -= n;
+        }
+    }
+#endif
+
     inline unsigned char inPort(unsigned char port)
     {
         switch (port) {
@@ -618,7 +742,7 @@ class MSX2
             case 0xA8: return this->mmu->getPrimary();
             case 0xA9: {
                 // to read the keyboard matrix row specified via the port AAh. (PPI's port B is used)
-                static unsigned char bit[8] = {
+                static const unsigned char bit[8] = {
                     0b00000001,
                     0b00000010,
                     0b00000100,
@@ -700,10 +824,16 @@ class MSX2
             case 0x7D: break;
 #else
             case 0x7C:
-                if (this->ym2413) OPLL_writeIO(this->ym2413, 0, value);
+                if (this->ym2413) {
+                    this->renderSound();
+                    OPLL_writeIO(this->ym2413, 0, value);
+                }
                 break;
             case 0x7D:
-                if (this->ym2413) OPLL_writeIO(this->ym2413, 1, value);
+                if (this->ym2413) {
+                    this->renderSound();
+                    OPLL_writeIO(this->ym2413, 1, value);
+                }
                 break;
 #endif
             case 0x81: break; // 8251 status command
@@ -718,7 +848,10 @@ class MSX2
             case 0x9A: this->vdp->outPort9A(value); break;
             case 0x9B: this->vdp->outPort9B(value); break;
             case 0xA0: this->psg->latch(value); break;
-            case 0xA1: this->psg->write(value); break;
+            case 0xA1:
+                this->renderSound();
+                this->psg->write(value);
+                break;
             case 0xA8: this->mmu->updatePrimary(value); break;
             case 0xAA: {
                 unsigned char mod = this->ctx.regC ^ value;
@@ -817,31 +950,43 @@ class MSX2
             return nullptr;
         }
         this->ib->quickSaveBufferPtr = 0;
-        this->writeSaveChunk("BRD", &this->ctx, (int)sizeof(this->ctx));
-        this->writeSaveChunk("Z80", &this->cpu->reg, (int)sizeof(this->cpu->reg));
-        this->writeSaveChunk("MMU", &this->mmu->ctx, (int)sizeof(this->mmu->ctx));
-        this->writeSaveChunk("PAC", &this->mmu->pac, (int)sizeof(this->mmu->pac));
-        this->writeSaveChunk("R:0", &this->mmu->ram, (int)sizeof(this->mmu->ram));
-        if (this->mmu->sramEnabled) {
-            this->writeSaveChunk("SRM", &this->mmu->sram, (int)sizeof(this->mmu->sram));
+        this->vdp->syncCommand();
+        this->renderSound();
+        this->writeSaveChunks(false);
+        *size = LZ4_compress_default(this->ib->quickSaveBuffer,
+                                     this->ib->quickSaveBufferCompressed,
+                                     (int)this->ib->quickSaveBufferPtr,
+                                     (int)this->ib->quickSaveBufferHeapSize);
+        return this->ib->quickSaveBufferCompressed;
+    }
+
+    // Save the current state as the base of the incremental snapshots (same format as quickSave)
+    const void* saveSnapshotBase(size_t* size)
+    {
+        if (!this->ib->allocateSnapshotBase(sizeof(this->mmu->ram), sizeof(this->vdp->ctx))) {
+            return nullptr;
         }
-        if (this->mmu->sccEnabled && this->scc) {
-            this->writeSaveChunk("SCC", &this->scc->ctx, (int)sizeof(this->scc->ctx));
+        const void* result = this->quickSave(size);
+        if (result) {
+            memcpy(this->ib->snapshotBaseRAM, this->mmu->ram, sizeof(this->mmu->ram));
+            memcpy(this->ib->snapshotBaseVDP, &this->vdp->ctx, sizeof(this->vdp->ctx));
         }
-        this->writeSaveChunk("PSG", &this->psg->ctx, (int)sizeof(this->psg->ctx));
-        this->writeSaveChunk("RTC", &this->clock->ctx, (int)sizeof(this->clock->ctx));
-        this->writeSaveChunk("KNJ", &this->kanji->ctx, (int)sizeof(this->kanji->ctx));
-        this->writeSaveChunk("VDP", &this->vdp->ctx, (int)sizeof(this->vdp->ctx));
-        if (this->fdc) {
-            this->writeSaveChunk("FDC", &this->fdc->ctx, (int)sizeof(this->fdc->ctx));
-            this->writeSaveChunk("JCT", &this->fdc->journalCount, (int)sizeof(this->fdc->journalCount));
-            this->writeSaveChunk("JDT", &this->fdc->journal, (int)sizeof(this->fdc->journal[0]) * this->fdc->journalCount);
+        return result;
+    }
+
+    // Save the current state as the difference from the base (RAM and VDP are saved in changed 256 bytes pages only)
+    const void* saveSnapshot(size_t* size)
+    {
+        if (!this->ib->snapshotBaseRAM || !this->ib->snapshotBaseVDP) {
+            return this->saveSnapshotBase(size);
         }
-#ifndef MSX2_REMOVE_OPLL
-        if (this->ym2413) {
-            this->writeSaveChunk("OPL", this->ym2413, (int)sizeof(OPLL));
+        if (!this->ib->allocateQuickSaveBuffer(this->calcQuickSaveSize(true))) {
+            return nullptr;
         }
-#endif
+        this->ib->quickSaveBufferPtr = 0;
+        this->vdp->syncCommand();
+        this->renderSound();
+        this->writeSaveChunks(true);
         *size = LZ4_compress_default(this->ib->quickSaveBuffer,
                                      this->ib->quickSaveBufferCompressed,
                                      (int)this->ib->quickSaveBufferPtr,
@@ -849,17 +994,53 @@ class MSX2
         return this->ib->quickSaveBufferCompressed;
     }
 
-    void quickLoad(const void* buffer, size_t bufferSize)
+    // Load the snapshot saved by saveSnapshot with the base saved by saveSnapshotBase (false: no memory or broken data)
+    bool loadSnapshot(const void* base, size_t baseSize, const void* snapshot, size_t snapshotSize)
+    {
+        if (!this->quickLoad(base, baseSize)) {
+            return false;
+        }
+        // the snapshot is larger than the quick save data if most of the pages are changed
+        if (!this->ib->allocateQuickSaveBuffer(this->calcQuickSaveSize(true))) {
+            return false;
+        }
+        int size = LZ4_decompress_safe((const char*)snapshot,
+                                       this->ib->quickSaveBuffer,
+                                       (int)snapshotSize,
+                                       (int)this->ib->quickSaveBufferHeapSize);
+        if (size < 0) {
+            return false;
+        }
+        this->extractSaveChunks(this->ib->quickSaveBuffer, size);
+        return true;
+    }
+
+    // false: no memory or broken data
+    bool quickLoad(const void* buffer, size_t bufferSize)
     {
         if (!this->ib->allocateQuickSaveBuffer(this->calcQuickSaveSize())) {
-            return;
+            return false;
         }
         this->reset();
         int size = LZ4_decompress_safe((const char*)buffer,
                                        this->ib->quickSaveBuffer,
                                        (int)bufferSize,
                                        (int)this->ib->quickSaveBufferHeapSize);
-        const char* ptr = this->ib->quickSaveBuffer;
+        if (size < 0) {
+            return false;
+        }
+        this->extractSaveChunks(this->ib->quickSaveBuffer, size);
+        return true;
+    }
+
+    unsigned short getBackdropColor()
+    {
+        return this->vdp ? this->vdp->getBackdropColor() : 0;
+    }
+
+  private:
+    void extractSaveChunks(const char* ptr, int size)
+    {
         while (8 <= size) {
             char chunk[4];
             int chunkSize;
@@ -886,6 +1067,9 @@ class MSX2
             } else if (0 == strcmp(chunk, "R:0")) {
                 putlog("extract R:0 (%d bytes)", chunkSize);
                 memcpy(&this->mmu->ram, ptr, chunkSize);
+            } else if (0 == strcmp(chunk, "D:R")) {
+                putlog("extract D:R (%d bytes)", chunkSize);
+                this->extractSnapshotChunk((unsigned char*)&this->mmu->ram, sizeof(this->mmu->ram), ptr, chunkSize);
             } else if (0 == strcmp(chunk, "SRM")) {
                 putlog("extract SRM (%d bytes)", chunkSize);
                 memcpy(&this->mmu->sram, ptr, chunkSize);
@@ -897,8 +1081,20 @@ class MSX2
                     putlog("ignored SCC (%d bytes)", chunkSize);
                 }
             } else if (0 == strcmp(chunk, "PSG")) {
-                putlog("extract PSG (%d bytes)", chunkSize);
-                memcpy(&this->psg->ctx, ptr, chunkSize);
+                if (sizeof(this->psg->ctx) == chunkSize) {
+                    putlog("extract PSG (%d bytes)", chunkSize);
+                    memcpy(&this->psg->ctx, ptr, chunkSize);
+                } else if ((int)(offsetof(AY8910::Context, reg) + sizeof(this->psg->ctx.reg)) <= chunkSize) {
+                    // saved by the former PSG emulator (latch and reg[] are at the same offsets): replay the registers
+                    putlog("extract PSG registers (%d bytes)", chunkSize);
+                    for (int i = 0; i < 16; i++) {
+                        this->psg->latch(i);
+                        this->psg->write(ptr[offsetof(AY8910::Context, reg) + i]);
+                    }
+                    this->psg->latch(ptr[offsetof(AY8910::Context, latch)]);
+                } else {
+                    putlog("ignored PSG (%d bytes)", chunkSize);
+                }
             } else if (0 == strcmp(chunk, "RTC")) {
                 putlog("extract RTC (%d bytes)", chunkSize);
                 memcpy(&this->clock->ctx, ptr, chunkSize);
@@ -910,6 +1106,13 @@ class MSX2
                 memcpy(&this->vdp->ctx, ptr, chunkSize);
                 this->vdp->updateAllPalettes();
                 this->vdp->updateEventTables();
+                this->vdp->resetSpriteCache();
+            } else if (0 == strcmp(chunk, "D:V")) {
+                putlog("extract D:V (%d bytes)", chunkSize);
+                this->extractSnapshotChunk((unsigned char*)&this->vdp->ctx, sizeof(this->vdp->ctx), ptr, chunkSize);
+                this->vdp->updateAllPalettes();
+                this->vdp->updateEventTables();
+                this->vdp->resetSpriteCache();
             } else if (0 == strcmp(chunk, "FDC")) {
                 if (this->fdc) {
                     putlog("extract FDC (%d bytes)", chunkSize);
@@ -936,7 +1139,9 @@ class MSX2
             } else if (0 == strcmp(chunk, "OPL")) {
                 if (this->ym2413) {
                     putlog("extract OPL (%d bytes)", chunkSize);
+                    OPLL_RateConv* conv = this->ym2413->conv; // the rate converter is not saved
                     memcpy(this->ym2413, ptr, chunkSize);
+                    this->ym2413->conv = conv;
                 } else {
                     putlog("ignored OPL (%d bytes)", chunkSize);
                 }
@@ -947,12 +1152,82 @@ class MSX2
         }
     }
 
-    unsigned short getBackdropColor()
+    void writeSaveChunks(bool snapshot)
     {
-        return this->vdp ? this->vdp->getBackdropColor() : 0;
+        this->writeSaveChunk("BRD", &this->ctx, (int)sizeof(this->ctx));
+        this->writeSaveChunk("Z80", &this->cpu->reg, (int)sizeof(this->cpu->reg));
+        this->writeSaveChunk("MMU", &this->mmu->ctx, (int)sizeof(this->mmu->ctx));
+        this->writeSaveChunk("PAC", &this->mmu->pac, (int)sizeof(this->mmu->pac));
+        if (snapshot) {
+            this->writeSnapshotChunk("D:R", this->ib->snapshotBaseRAM, this->mmu->ram, (int)sizeof(this->mmu->ram));
+        } else {
+            this->writeSaveChunk("R:0", &this->mmu->ram, (int)sizeof(this->mmu->ram));
+        }
+        if (this->mmu->sramEnabled) {
+            this->writeSaveChunk("SRM", &this->mmu->sram, (int)sizeof(this->mmu->sram));
+        }
+        if (this->mmu->sccEnabled && this->scc) {
+            this->writeSaveChunk("SCC", &this->scc->ctx, (int)sizeof(this->scc->ctx));
+        }
+        this->writeSaveChunk("PSG", &this->psg->ctx, (int)sizeof(this->psg->ctx));
+        this->writeSaveChunk("RTC", &this->clock->ctx, (int)sizeof(this->clock->ctx));
+        this->writeSaveChunk("KNJ", &this->kanji->ctx, (int)sizeof(this->kanji->ctx));
+        if (snapshot) {
+            this->writeSnapshotChunk("D:V", this->ib->snapshotBaseVDP, (const unsigned char*)&this->vdp->ctx, (int)sizeof(this->vdp->ctx));
+        } else {
+            this->writeSaveChunk("VDP", &this->vdp->ctx, (int)sizeof(this->vdp->ctx));
+        }
+        if (this->fdc) {
+            this->writeSaveChunk("FDC", &this->fdc->ctx, (int)sizeof(this->fdc->ctx));
+            this->writeSaveChunk("JCT", &this->fdc->journalCount, (int)sizeof(this->fdc->journalCount));
+            this->writeSaveChunk("JDT", &this->fdc->journal, (int)sizeof(this->fdc->journal[0]) * this->fdc->journalCount);
+        }
+#ifndef MSX2_REMOVE_OPLL
+        if (this->ym2413) {
+            this->writeSaveChunk("OPL", this->ym2413, (int)sizeof(OPLL));
+        }
+#endif
+    }
+
+    // chunk data = { page number (4 bytes), page data (256 bytes) } x pages that differ from the base
+    void writeSnapshotChunk(const char* name, const unsigned char* base, const unsigned char* data, int size)
+    {
+        size_t head = this->ib->quickSaveBufferPtr;
+        this->ib->quickSaveBufferPtr += 8;
+        for (int page = 0; page * 256 < size; page++) {
+            int pageSize = size - page * 256 < 256 ? size - page * 256 : 256;
+            if (0 != memcmp(&base[page * 256], &data[page * 256], pageSize)) {
+                memcpy(&this->ib->quickSaveBuffer[this->ib->quickSaveBufferPtr], &page, 4);
+                this->ib->quickSaveBufferPtr += 4;
+                memcpy(&this->ib->quickSaveBuffer[this->ib->quickSaveBufferPtr], &data[page * 256], pageSize);
+                this->ib->quickSaveBufferPtr += pageSize;
+            }
+        }
+        int chunkSize = (int)(this->ib->quickSaveBufferPtr - head - 8);
+        if (chunkSize < 1) {
+            this->ib->quickSaveBufferPtr = head; // no changed page
+            return;
+        }
+        memcpy(&this->ib->quickSaveBuffer[head], name, 4);
+        memcpy(&this->ib->quickSaveBuffer[head + 4], &chunkSize, 4);
+    }
+
+    void extractSnapshotChunk(unsigned char* data, int size, const char* ptr, int chunkSize)
+    {
+        while (4 <= chunkSize) {
+            int page;
+            memcpy(&page, ptr, 4);
+            ptr += 4;
+            chunkSize -= 4;
+            if (page < 0 || size <= page * 256) break;
+            int pageSize = size - page * 256 < 256 ? size - page * 256 : 256;
+            if (chunkSize < pageSize) break;
+            memcpy(&data[page * 256], ptr, pageSize);
+            ptr += pageSize;
+            chunkSize -= pageSize;
+        }
     }
 
-  private:
     void writeSaveChunk(const char* name, const void* data, int size)
     {
         memcpy(&this->ib->quickSaveBuffer[this->ib->quickSaveBufferPtr], name, 4);
@@ -963,7 +1238,7 @@ class MSX2
         this->ib->quickSaveBufferPtr += size;
     }
 
-    size_t calcQuickSaveSize()
+    size_t calcQuickSaveSize(bool snapshot = false)
     {
         size_t size = 0;
         size += sizeof(this->ctx) + 8;                                               // BRD
@@ -987,6 +1262,10 @@ class MSX2
             size += sizeof(OPLL) + 8; // OPL
         }
 #endif
+        if (snapshot) {
+            size += (sizeof(this->mmu->ram) + 255) / 256 * 4;  // page numbers of D:R
+            size += (sizeof(this->vdp->ctx) + 255) / 256 * 4; // page numbers of D:V
+        }
         return size;
     }
 };
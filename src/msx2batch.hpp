@@ -0,0 +1,101 @@
+/**
+ * micro MSX2+ - Batch runner
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef INCLUDE_MSX2BATCH_HPP
+#define INCLUDE_MSX2BATCH_HPP
+#include "msx2.hpp"
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+class MSX2Batch
+{
+  private:
+    struct Job {
+        int colorMode;
+        bool ym2413Enabled;
+        std::function<void(MSX2* msx2)> procedure;
+    };
+
+    std::vector<Job> jobs;
+    int threadCount;
+
+  public:
+    // threadCount: number of worker threads (0 = number of CPU cores)
+    MSX2Batch(int threadCount = 0)
+    {
+        if (threadCount < 1) {
+            threadCount = (int)std::thread::hardware_concurrency();
+        }
+        this->threadCount = threadCount < 1 ? 1 : threadCount;
+    }
+
+    int getThreadCount()
+    {
+        return this->threadCount;
+    }
+
+    // The procedure is called on a worker thread with an MSX2 instance created for the job.
+    // The instance is deleted when the procedure returns, so copy out the results in the procedure.
+    // ROM images can be shared between jobs, but other buffers passed to the instance should be owned by the job.
+    void add(int colorMode, bool ym2413Enabled, const std::function<void(MSX2* msx2)>& procedure)
+    {
+        Job job;
+        job.colorMode = colorMode;
+        job.ym2413Enabled = ym2413Enabled;
+        job.procedure = procedure;
+        this->jobs.push_back(job);
+    }
+
+    // Executes all added jobs and waits for their completion (the job list is cleared after execution)
+    void run()
+    {
+#ifndef MSX2_REMOVE_OPLL
+        // emu2413 creates its shared tables when the first instance is created, so create them before starting workers
+        OPLL_delete(OPLL_new(3584160, 44100));
+#endif
+        std::atomic<size_t> next(0);
+        size_t workerCount = this->jobs.size() < (size_t)this->threadCount ? this->jobs.size() : (size_t)this->threadCount;
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < workerCount; i++) {
+            workers.push_back(std::thread([this, &next]() {
+                for (size_t index = next++; index < this->jobs.size(); index = next++) {
+                    Job* job = &this->jobs[index];
+                    MSX2* msx2 = new MSX2(job->colorMode, job->ym2413Enabled);
+                    job->procedure(msx2);
+                    delete msx2;
+                }
+            }));
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        this->jobs.clear();
+    }
+};
+
+#endif // INCLUDE_MSX2BATCH_HPP
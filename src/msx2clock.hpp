@@ -82,7 +82,12 @@ class MSX2Clock
 
     inline void update()
     {
-        struct tm* t2 = localtime(&this->ctx.time);
+        struct tm tm;
+#ifdef _WIN32
+        struct tm* t2 = 0 == localtime_s(&tm, &this->ctx.time) ? &tm : nullptr;
+#else
+        struct tm* t2 = localtime_r(&this->ctx.time, &tm); // localtime is not thread-safe
+#endif
         this->ctx.seconds = t2->tm_sec;
         this->ctx.minutes = t2->tm_min;
         this->ctx.hours = t2->tm_hour;
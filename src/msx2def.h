@@ -44,5 +44,11 @@
 #define MSX2_ROM_TYPE_ASC16_SRAM2 4
 #define MSX2_ROM_TYPE_KONAMI_SCC 5
 #define MSX2_ROM_TYPE_KONAMI 6
+#define MSX2_SOUND_FORMAT_S16 0
+#define MSX2_SOUND_FORMAT_F32 1
+#define MSX2_PIXEL_FORMAT_RGB555 0
+#define MSX2_PIXEL_FORMAT_RGB565 1
+#define MSX2_PIXEL_FORMAT_XRGB8888 2
+#define MSX2_PIXEL_FORMAT_RGBA8888 3
 
 #endif /* INCLUDE_MSX2DEF */
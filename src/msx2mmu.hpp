@@ -81,6 +81,12 @@ class MSX2MMU
         unsigned char isSelectSRAM[8];
     } ctx;
 
+    // Pointers of the 8KB blocks currently visible from the CPU (nullptr: access via readIO/writeIO)
+    struct PageTable {
+        unsigned char* read[8];
+        unsigned char* write[8];
+    } pageTable;
+
     bool sccEnabled;
     bool sramEnabled;
     unsigned char sram[0x2000];
@@ -91,6 +97,7 @@ class MSX2MMU
     {
         memset(&this->slots, 0, sizeof(this->slots));
         memset(&this->secondaryExist, 0, sizeof(this->secondaryExist));
+        memset(&this->pageTable, 0, sizeof(this->pageTable));
         memset(this->sram, 0, sizeof(this->sram));
         memset(this->pac, 0, sizeof(this->pac));
         this->sramEnabled = false;
@@ -132,6 +139,7 @@ class MSX2MMU
         this->ctx.mmap[1] = 2;
         this->ctx.mmap[2] = 1;
         this->ctx.mmap[3] = 0;
+        this->updatePageTable();
     }
 
     void clearCartridge()
@@ -144,6 +152,7 @@ class MSX2MMU
         for (int pri = 1; pri <= 2; pri++) {
             memset(&this->slots[pri][0], 0, sizeof(Slot));
         }
+        this->updatePageTable();
     }
 
     void setupCartridge(int pri, int sec, int idx, void* data, size_t size, int romType)
@@ -211,6 +220,7 @@ class MSX2MMU
             this->slots[pri][sec].data[i].isFmBios = false;
             this->slots[pri][sec].data[i].ptr = &this->ram[i * 0x2000];
         }
+        this->updatePageTable();
     }
 
     void setup(int pri, int sec, int idx, unsigned char* data, int size, const char* label)
@@ -257,12 +267,26 @@ class MSX2MMU
                 }
             }
         }
+        this->updatePageTable();
+    }
+
+    inline void updatePageTable()
+    {
+        for (int idx = 0; idx < 8; idx++) {
+            int page = idx / 2;
+            auto data = &this->slots[this->ctx.pri[page]][this->ctx.sec[page]].data[idx];
+            // FM-BIOS (PAC SRAM) and the FDC registers of the DISK-BIOS ($3FF0~$3FFF) are mapped to I/O
+            bool isIO = data->isFmBios || (data->isDiskBios && (idx & 1));
+            this->pageTable.read[idx] = isIO ? nullptr : data->ptr;
+            this->pageTable.write[idx] = data->isRAM ? data->ptr : nullptr;
+        }
     }
 
     inline void updateMemoryMapper(int page, unsigned char value)
     {
         // printf("update memory mapper: page %d = %d\n", page, value);
         this->ctx.mmap[page] = value;
+        this->updatePageTable();
     }
 
     inline unsigned char getPrimary()
@@ -284,6 +308,7 @@ class MSX2MMU
             this->ctx.sec[page] = sec;
             value >>= 2;
         }
+        this->updatePageTable();
     }
 
     inline unsigned char getSecondary()
@@ -310,6 +335,7 @@ class MSX2MMU
                 }
                 value >>= 2;
             }
+            this->updatePageTable();
         }
     }
 
@@ -328,6 +354,12 @@ class MSX2MMU
         if (addr == 0xFFFF) {
             return this->getSecondary();
         }
+        auto ptr = this->pageTable.read[addr / 0x2000];
+        return ptr ? ptr[addr & 0x1FFF] : this->readIO(addr);
+    }
+
+    inline unsigned char readIO(unsigned short addr)
+    {
         int page = (addr & 0b1100000000000000) >> 14;
         int pri = this->ctx.pri[page];
         int sec = this->ctx.sec[page];
@@ -359,6 +391,16 @@ class MSX2MMU
             this->updateSecondary(value);
             return;
         }
+        auto ptr = this->pageTable.write[addr / 0x2000];
+        if (ptr) {
+            ptr[addr & 0x1FFF] = value;
+        } else {
+            this->writeIO(addr, value);
+        }
+    }
+
+    inline void writeIO(unsigned short addr, unsigned char value)
+    {
         int page = (addr & 0b1100000000000000) >> 14;
         int pri = this->ctx.pri[page];
         int sec = this->ctx.sec[page];
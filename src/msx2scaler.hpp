@@ -0,0 +1,98 @@
+/**
+ * micro MSX2+ - integer scaler of 32-bit pixel images
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef INCLUDE_MSX2SCALER_HPP
+#define INCLUDE_MSX2SCALER_HPP
+#include <string.h>
+
+#if !defined(MSX2SCALER_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+#define MSX2SCALER_SIMD_SSE2
+#include <emmintrin.h>
+#elif !defined(MSX2SCALER_DISABLE_SIMD) && defined(__ARM_NEON)
+#define MSX2SCALER_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+class MSX2Scaler
+{
+  public:
+    // repeat each 32-bit pixel of the line scaleX (1-3) times
+    static inline void scaleLine(const unsigned int* src, unsigned int* dst, int width, int scaleX = 1)
+    {
+        if (scaleX < 2) {
+            memcpy(dst, src, width * 4);
+            return;
+        }
+        int x = 0;
+#if defined(MSX2SCALER_SIMD_SSE2)
+        for (; x + 4 <= width; x += 4) {
+            __m128i p = _mm_loadu_si128((const __m128i*)&src[x]);
+            __m128i* out = (__m128i*)&dst[x * scaleX];
+            if (2 == scaleX) {
+                _mm_storeu_si128(out, _mm_unpacklo_epi32(p, p));
+                _mm_storeu_si128(out + 1, _mm_unpackhi_epi32(p, p));
+            } else {
+                _mm_storeu_si128(out, _mm_shuffle_epi32(p, _MM_SHUFFLE(1, 0, 0, 0)));
+                _mm_storeu_si128(out + 1, _mm_shuffle_epi32(p, _MM_SHUFFLE(2, 2, 1, 1)));
+                _mm_storeu_si128(out + 2, _mm_shuffle_epi32(p, _MM_SHUFFLE(3, 3, 3, 2)));
+            }
+        }
+#elif defined(MSX2SCALER_SIMD_NEON)
+        for (; x + 4 <= width; x += 4) {
+            uint32x4_t p = vld1q_u32(&src[x]);
+            if (2 == scaleX) {
+                uint32x4x2_t v = {{p, p}};
+                vst2q_u32(&dst[x * 2], v);
+            } else {
+                uint32x4x3_t v = {{p, p, p}};
+                vst3q_u32(&dst[x * 3], v);
+            }
+        }
+#endif
+        for (; x < width; x++) {
+            for (int i = 0; i < scaleX; i++) {
+                dst[x * scaleX + i] = src[x];
+            }
+        }
+    }
+
+    // scale a 32-bit image by scaleX and scaleY (1-3)
+    // srcPitch and dstPitch are bytes per line (negative value for the bottom-up image)
+    static void render(const void* src, int width, int height, int srcPitch, void* dst, int dstPitch, int scaleX = 1, int scaleY = 1)
+    {
+        const unsigned char* in = (const unsigned char*)src;
+        unsigned char* row = (unsigned char*)dst;
+        for (int y = 0; y < height; y++, in += srcPitch) {
+            scaleLine((const unsigned int*)in, (unsigned int*)row, width, scaleX);
+            for (int i = 1; i < scaleY; i++) {
+                memcpy(row + dstPitch * i, row, width * scaleX * 4);
+            }
+            row += dstPitch * scaleY;
+        }
+    }
+};
+
+#endif
@@ -28,8 +28,23 @@
 #define INCLUDE_SCC_HPP
 #include <string.h>
 
+#if !defined(SCC_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+#define SCC_SIMD_SSE2
+#include <emmintrin.h>
+#elif !defined(SCC_DISABLE_SIMD) && defined(__ARM_NEON)
+#define SCC_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+#define SCC_RENDER_CHUNK 256
+
 class SCC
 {
+  private:
+    int cycles;     // CPU clocks per sample (integer part)
+    int cyclesRem;  // CPU clocks per sample (fractional part in units of 1 / sampleRate)
+    int sampleRate; // output sampling rate
+
   public:
     bool enabled;
     struct Channel {
@@ -43,12 +58,32 @@ class SCC
     struct Context {
         struct Channel ch[5];
         int sw;
+        int samplePhase; // accumulated fractional part of the CPU clocks per sample
     } ctx;
 
     SCC()
     {
         this->reset();
         this->enabled = false;
+        this->setClock(3584160, 44100);
+    }
+
+    void setClock(int cpuClock, int sampleRate)
+    {
+        this->cycles = cpuClock / sampleRate;
+        this->cyclesRem = cpuClock % sampleRate;
+        this->sampleRate = sampleRate;
+    }
+
+    // CPU clocks of the next sample (the fractional part is carried over so that the pitch does not depend on the sampling rate)
+    inline int stepCycles()
+    {
+        this->ctx.samplePhase += this->cyclesRem;
+        if (this->sampleRate <= this->ctx.samplePhase) {
+            this->ctx.samplePhase -= this->sampleRate;
+            return this->cycles + 1;
+        }
+        return this->cycles;
     }
 
     void reset() { memset(&this->ctx, 0, sizeof(this->ctx)); }
@@ -103,7 +138,161 @@ class SCC
         *right = this->to_short((*right) + result);
     }
 
+    // mix samples into the buffer (stereo: buf[0] = left, buf[1] = right, ...)
+    inline void render(short* buf, int samples, int channels = 2)
+    {
+        if (!this->enabled) return;
+        short waves[5][SCC_RENDER_CHUNK];
+        short volumes[5];
+        int cycles[SCC_RENDER_CHUNK];
+        while (0 < samples) {
+            int n = samples < SCC_RENDER_CHUNK ? samples : SCC_RENDER_CHUNK;
+            int totalCycles = 0;
+            for (int j = 0; j < n; j++) {
+                cycles[j] = this->stepCycles();
+                totalCycles += cycles[j];
+            }
+            int sw = this->ctx.sw;
+            for (int i = 0; i < 5; i++, sw >>= 1) {
+                volumes[i] = sw & 1 ? this->ctx.ch[i].volume : 0;
+                if (volumes[i]) {
+                    this->fetchWaveforms(i, waves[i], cycles, n);
+                } else {
+                    this->skipWaveforms(i, totalCycles, n);
+                    memset(waves[i], 0, sizeof(short) * n);
+                }
+            }
+            if (1 == channels) {
+                this->mixMono(buf, waves, volumes, n);
+            } else {
+                this->mix(buf, waves, volumes, n);
+            }
+            buf += n * channels;
+            samples -= n;
+        }
+    }
+
   private:
+    // step the waveform index of the channel for each sample and fetch the waveforms
+    inline void fetchWaveforms(int i, short* wave, const int* cycles, int samples)
+    {
+        Channel* ch = &this->ctx.ch[i];
+        const signed char* waveforms = this->ctx.ch[4 == i ? 3 : i].waveforms;
+        int counter = ch->counter;
+        int period = ch->period;
+        int index = ch->index;
+        if (period) {
+            for (int j = 0; j < samples; j++) {
+                counter += cycles[j];
+                if (0 <= counter) {
+                    int steps = counter / period + 1;
+                    counter -= steps * period;
+                    index += steps;
+                }
+                wave[j] = waveforms[index & 0x1F];
+            }
+        } else {
+            for (int j = 0; j < samples; j++) {
+                wave[j] = waveforms[++index & 0x1F];
+            }
+        }
+        ch->counter = counter;
+        ch->index = index & 0x1F;
+    }
+
+    // step the waveform index of the muted channel in closed form
+    inline void skipWaveforms(int i, int cycles, int samples)
+    {
+        Channel* ch = &this->ctx.ch[i];
+        int steps = samples;
+        if (ch->period) {
+            ch->counter += cycles;
+            steps = 0 <= ch->counter ? ch->counter / ch->period + 1 : 0;
+            ch->counter -= steps * ch->period;
+        }
+        ch->index = (ch->index + steps) & 0x1F;
+    }
+
+    // add sum of the (waveform x volume) of the channels to the stereo buffer with saturation
+    inline void mix(short* buf, short waves[5][SCC_RENDER_CHUNK], const short* volumes, int samples)
+    {
+        int j = 0;
+#if defined(SCC_SIMD_SSE2)
+        __m128i v0 = _mm_set1_epi16(volumes[0]);
+        __m128i v1 = _mm_set1_epi16(volumes[1]);
+        __m128i v2 = _mm_set1_epi16(volumes[2]);
+        __m128i v3 = _mm_set1_epi16(volumes[3]);
+        __m128i v4 = _mm_set1_epi16(volumes[4]);
+        for (; j + 8 <= samples; j += 8) {
+            __m128i m = _mm_mullo_epi16(_mm_loadu_si128((const __m128i*)&waves[0][j]), v0);
+            m = _mm_add_epi16(m, _mm_mullo_epi16(_mm_loadu_si128((const __m128i*)&waves[1][j]), v1));
+            m = _mm_add_epi16(m, _mm_mullo_epi16(_mm_loadu_si128((const __m128i*)&waves[2][j]), v2));
+            m = _mm_add_epi16(m, _mm_mullo_epi16(_mm_loadu_si128((const __m128i*)&waves[3][j]), v3));
+            m = _mm_add_epi16(m, _mm_mullo_epi16(_mm_loadu_si128((const __m128i*)&waves[4][j]), v4));
+            __m128i* out = (__m128i*)&buf[j * 2];
+            _mm_storeu_si128(out, _mm_adds_epi16(_mm_loadu_si128(out), _mm_unpacklo_epi16(m, m)));
+            _mm_storeu_si128(out + 1, _mm_adds_epi16(_mm_loadu_si128(out + 1), _mm_unpackhi_epi16(m, m)));
+        }
+#elif defined(SCC_SIMD_NEON)
+        for (; j + 8 <= samples; j += 8) {
+            int16x8_t m = vmulq_n_s16(vld1q_s16(&waves[0][j]), volumes[0]);
+            m = vmlaq_n_s16(m, vld1q_s16(&waves[1][j]), volumes[1]);
+            m = vmlaq_n_s16(m, vld1q_s16(&waves[2][j]), volumes[2]);
+            m = vmlaq_n_s16(m, vld1q_s16(&waves[3][j]), volumes[3]);
+            m = vmlaq_n_s16(m, vld1q_s16(&waves[4][j]), volumes[4]);
+            int16x8x2_t lr = vzipq_s16(m, m);
+            vst1q_s16(&buf[j * 2], vqaddq_s16(vld1q_s16(&buf[j * 2]), lr.val[0]));
+            vst1q_s16(&buf[j * 2 + 8], vqaddq_s16(vld1q_s16(&buf[j * 2 + 8]), lr.val[1]));
+        }
+#endif
+        for (; j < samples; j++) {
+            int m = 0;
+            for (int i = 0; i < 5; i++) {
+                m += waves[i][j] * volumes[i];
+            }
+            buf[j * 2] = this->to_short(buf[j * 2] + m);
+            buf[j * 2 + 1] = this->to_short(buf[j * 2 + 1] + m);
+        }
+    }
+
+    // add sum of the (waveform x volume) of the channels to the monaural buffer with saturation
+    inline void mixMono(short* buf, short waves[5][SCC_RENDER_CHUNK], const short* volumes, int samples)
+    {
+        int j = 0;
+#if defined(SCC_SIMD_SSE2)
+        __m128i v0 = _mm_set1_epi16(volumes[0]);
+        __m128i v1 = _mm_set1_epi16(volumes[1]);
+        __m128i v2 = _mm_set1_epi16(volumes[2]);
+        __m128i v3 = _mm_set1_epi16(volumes[3]);
+        __m128i v4 = _mm_set1_epi16(volumes[4]);
+        for (; j + 8 <= samples; j += 8) {
+            __m128i m = _mm_mullo_epi16(_mm_loadu_si128((const __m128i*)&waves[0][j]), v0);
+            m = _mm_add_epi16(m, _mm_mullo_epi16(_mm_loadu_si128((const __m128i*)&waves[1][j]), v1));
+            m = _mm_add_epi16(m, _mm_mullo_epi16(_mm_loadu_si128((const __m128i*)&waves[2][j]), v2));
+            m = _mm_add_epi16(m, _mm_mullo_epi16(_mm_loadu_si128((const __m128i*)&waves[3][j]), v3));
+            m = _mm_add_epi16(m, _mm_mullo_epi16(_mm_loadu_si128((const __m128i*)&waves[4][j]), v4));
+            __m128i* out = (__m128i*)&buf[j];
+            _mm_storeu_si128(out, _mm_adds_epi16(_mm_loadu_si128(out), m));
+        }
+#elif defined(SCC_SIMD_NEON)
+        for (; j + 8 <= samples; j += 8) {
+            int16x8_t m = vmulq_n_s16(vld1q_s16(&waves[0][j]), volumes[0]);
+            m = vmlaq_n_s16(m, vld1q_s16(&waves[1][j]), volumes[1]);
+            m = vmlaq_n_s16(m, vld1q_s16(&waves[2][j]), volumes[2]);
+            m = vmlaq_n_s16(m, vld1q_s16(&waves[3][j]), volumes[3]);
+            m = vmlaq_n_s16(m, vld1q_s16(&waves[4][j]), volumes[4]);
+            vst1q_s16(&buf[j], vqaddq_s16(vld1q_s16(&buf[j]), m));
+        }
+#endif
+        for (; j < samples; j++) {
+            int m = 0;
+            for (int i = 0; i < 5; i++) {
+                m += waves[i][j] * volumes[i];
+            }
+            buf[j] = this->to_short(buf[j] + m);
+        }
+    }
+
     inline short to_short(int i)
     {
         if (32767 < i) return (short)32767;
@@ -32,6 +32,20 @@
 #include <string.h>
 // #define COMMAND_DEBUG
 
+#if !defined(V9958_DISABLE_SIMD) && defined(__AVX2__)
+#define V9958_SIMD_AVX2
+#include <immintrin.h>
+#elif !defined(V9958_DISABLE_SIMD) && defined(__SSSE3__)
+#define V9958_SIMD_SSSE3
+#include <tmmintrin.h>
+#elif !defined(V9958_DISABLE_SIMD) && defined(__ARM_NEON)
+#define V9958_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#if defined(V9958_SIMD_AVX2) || defined(V9958_SIMD_SSSE3) || defined(V9958_SIMD_NEON)
+#define V9958_SIMD
+#endif
+
 class V9958
 {
   private:
@@ -58,7 +72,61 @@ class V9958
         VerticalEventType vt[262];
         int hi[1368];
         int vi[262];
+        int hn[1368]; // number of dots until the next horizontal event
     } evt;
+    int commandDots; // dots elapsed while a command is executing (consumed by syncCommand)
+
+    // status changes made while rendering a scanline (replayed when lazyRendering skips the line)
+    struct LineCache {
+        unsigned int version;
+        unsigned int vramVersion; // vramVersion when the scanline was rendered
+        bool limitOverSprites;
+        int lastRenderScanline; // -1: not changed
+        int sprite5S;           // -1: not changed
+        int spriteN;
+        int collisionX; // -1: not changed
+        int collisionY;
+    } lineCache[240];
+    LineCache* lineLog;
+#ifdef V9958_SIMD
+    // work buffers of the SIMD bitmap renderers (GRAPHIC4-7)
+    struct BitmapLUT {
+        unsigned char lo[2][16]; // lower byte of the pixel ([0]: lower nibble, [1]: upper nibble of the source byte)
+        unsigned char hi[2][16]; // upper byte of the pixel ([0]: lower nibble, [1]: upper nibble of the source byte)
+    } bitmapLUT;
+    unsigned char bitmapLine[256 + 16];
+    unsigned char bitmapIndex[512 + 64];
+#endif
+    unsigned int renderVersion;        // incremented when registers or palettes that affect rendering are changed
+    unsigned int vramVersion;          // incremented when VRAM is written
+    unsigned int vramPageVersion[512]; // vramVersion of the last write to each 256 bytes of VRAM
+
+    // visible sprites of each scanline (mode 2) built from the sprite tables
+    struct SpriteCache {
+        unsigned int version; // spriteVersion that the entries were built with
+        int used;             // number of the used entries
+        struct Line {
+            unsigned int version; // valid if equal to spriteVersion
+            unsigned short start; // first entry
+            unsigned char count;  // number of the visible sprites
+        } line[256];
+        struct Entry {
+            unsigned int pattern; // pixels of the scanline (bit n: x + n)
+            short x;              // left position (EC applied)
+            unsigned char sn;     // sprite number
+            unsigned char col;    // color table (CC, IC and color code)
+        } entry[1024];            // every sprite is visible on 32 lines at most
+    } spriteCache;
+    unsigned int spriteVersion; // incremented when the sprite tables or the registers that affect them are changed
+
+    // external framebuffer that receives each rendered scanline converted to the output pixel format
+    struct OutputBuffer {
+        unsigned char* pixels; // nullptr: render only to the display
+        int pitch;             // bytes per scanline (negative value for the bottom-up buffer)
+        int format;            // 0: RGB555, 1: RGB565, 2: XRGB8888, 3: RGBA8888
+        unsigned int lo[256];  // output pixel of the lower byte of a display pixel
+        unsigned int hi[256];  // output pixel of the upper byte of a display pixel
+    } output;
 
     inline void updateEventTableH()
     {
@@ -91,6 +159,15 @@ class V9958
                 this->evt.hi[ii] = i - 1024 - 56 - 30 - 100 - 102;
             }
         }
+        for (int i = 1367, n = 1; 0 <= i; i--, n++) {
+            if (this->evt.ht[i] != this->evt.ht[(i + 1) % 1368]) {
+                n = 1;
+            }
+            this->evt.hn[i] = n;
+        }
+        for (int i = 1367; this->evt.ht[i] == this->evt.ht[(i + 1) % 1368]; i--) {
+            this->evt.hn[i] = this->evt.hn[(i + 1) % 1368] + 1;
+        }
     }
 
     inline void updateEventTableV()
@@ -124,7 +201,6 @@ class V9958
         }
     }
 
-    unsigned short yjkColor[32][64][64];
     const unsigned char regMask[64] = {
         0x7e, 0x7b, 0x7f, 0xff, 0x3f, 0xff, 0x3f, 0xff,
         0xfb, 0xbf, 0x07, 0x03, 0xff, 0xff, 0x07, 0x0f,
@@ -145,11 +221,15 @@ class V9958
 
   public:
     bool renderLimitOverSprites = true;
+    bool lazyRendering = false; // re-render only the scanlines that may differ from the last rendered frame
+    bool skipRendering = false; // update the VDP status without rendering the display
+    // render the display in 284 pixels width (false: 568 pixels width)
 #ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-    unsigned short display[284 * 240];
+    bool halfHorizontal = true;
 #else
-    unsigned short display[568 * 240];
+    bool halfHorizontal = false;
 #endif
+    unsigned short display[568 * 240];
     unsigned short palette[16];
     unsigned char lastRenderScanline;
 
@@ -196,6 +276,13 @@ class V9958
     V9958()
     {
         memset(palette, 0, sizeof(palette));
+        memset(lineCache, 0, sizeof(lineCache));
+        memset(&output, 0, sizeof(output));
+        memset(&spriteCache, 0, sizeof(spriteCache));
+        this->renderVersion = 0;
+        this->spriteVersion = 1;
+        this->vramVersion = 0;
+        memset(vramPageVersion, 0, sizeof(vramPageVersion));
         this->reset();
     }
 
@@ -206,32 +293,79 @@ class V9958
         this->detectInterrupt = detectInterrupt;
         this->cancelInterrupt = cancelInterrupt;
         this->detectBreak = detectBreak;
-        this->initYjkColorTable();
+        this->updateOutputCache();
         this->reset();
     }
 
-    void initYjkColorTable()
-    {
-        for (int y = 0; y < 32; y++) {
-            for (int J = 0; J < 64; J++) {
-                for (int K = 0; K < 64; K++) {
-                    int j = (J & 0x1f) - (J & 0x20);
-                    int k = (K & 0x1f) - (K & 0x20);
-                    int r = 255 * (y + j) / 31;
-                    int g = 255 * (y + k) / 31;
-                    int b = 255 * ((5 * y - 2 * j - k) / 4) / 31;
-                    r = this->min(255, this->max(0, r));
-                    g = this->min(255, this->max(0, g));
-                    b = this->min(255, this->max(0, b));
-                    r = (r & 0b11111000) << (7 + colorMode);
-                    g = (g & 0b11111000) << (2 + colorMode);
-                    b = (b & 0b11111000) >> 3;
-                    this->yjkColor[y][J][K] = r | g | b;
-                }
-            }
+    void setHalfHorizontal(bool halfHorizontal)
+    {
+        if (this->halfHorizontal != halfHorizontal) {
+            this->halfHorizontal = halfHorizontal;
+            this->renderVersion++; // all scanlines must be re-rendered in the new width
+        }
+    }
+
+    void setOutputBuffer(void* pixels, int pitch, int format)
+    {
+        // the conversion cache is kept while switching between the buffers of the same format (e.g. triple buffering)
+        bool update = !this->output.pixels || this->output.format != format;
+        this->output.pixels = (unsigned char*)pixels;
+        this->output.pitch = pitch;
+        this->output.format = format;
+        if (update) {
+            this->updateOutputCache();
         }
     }
 
+    void updateOutputCache()
+    {
+        // every output bit is a copy of a display bit, so the pixel can be converted by OR-ing the caches of 2 bytes
+        for (int i = 0; i < 256; i++) {
+            this->output.lo[i] = this->convertDisplayPixel(i);
+            this->output.hi[i] = this->convertDisplayPixel(i << 8);
+        }
+    }
+
+    inline unsigned int convertDisplayPixel(unsigned short c)
+    {
+        unsigned int r, g, b;
+        if (1 == this->colorMode) {
+            r = (c & 0b1111100000000000) >> 8;
+            g = (c & 0b0000011111100000) >> 3;
+            b = (c & 0b0000000000011111) << 3;
+            g |= g >> 6;
+        } else {
+            r = (c & 0b0111110000000000) >> 7;
+            g = (c & 0b0000001111100000) >> 2;
+            b = (c & 0b0000000000011111) << 3;
+            g |= g >> 5;
+        }
+        r |= r >> 5;
+        b |= b >> 5;
+        switch (this->output.format) {
+            case 0: return (r & 0b11111000) << 7 | (g & 0b11111000) << 2 | b >> 3; // RGB555
+            case 1: return (r & 0b11111000) << 8 | (g & 0b11111100) << 3 | b >> 3; // RGB565
+            case 2: return 0xFF000000 | r << 16 | g << 8 | b;                      // XRGB8888
+            case 3: return r << 24 | g << 16 | b << 8 | 0xFF;                      // RGBA8888
+            default: return 0;
+        }
+    }
+
+    // Y: 0-31, J/K: -32-31
+    // each component is 255 * n / 31 clamped to 0-255 and truncated to 5 bits, which equals n clamped to 0-31
+    inline unsigned short convertColorYJK(int y, int j, int k)
+    {
+        int r = this->min(31, this->max(0, y + j));
+        int g = this->min(31, this->max(0, y + k));
+        int b = this->min(31, this->max(0, (5 * y - 2 * j - k) / 4));
+        return r << (10 + this->colorMode) | g << (5 + this->colorMode) | b;
+    }
+
+    void resetSpriteCache()
+    {
+        this->spriteVersion++;
+    }
+
     void updateAllPalettes()
     {
         for (int i = 0; i < 16; i++) {
@@ -241,7 +375,7 @@ class V9958
 
     void reset()
     {
-        static unsigned int rgb[16] = {
+        static const unsigned int rgb[16] = {
             0x000000, 0x000000,
             //***     ***     ***
             0b110000000010000000100000, // 6 1 1
@@ -259,10 +393,10 @@ class V9958
             0b101000101000000010100000, // 5 5 5
             0b111000111000000011100000  // 7 7 7
         };
-        static unsigned char stat[16] = {
+        static const unsigned char stat[16] = {
             0x1f, 0x00, 0xcc, 0x40, 0x00, 0x00, 0x00, 0x00,
             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-        static unsigned char reg[64] = {
+        static const unsigned char reg[64] = {
             0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
             0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -273,6 +407,10 @@ class V9958
             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
         memset(this->display, 0, sizeof(this->display));
         memset(&this->ctx, 0, sizeof(this->ctx));
+        this->commandDots = 0;
+        this->lineLog = nullptr;
+        this->renderVersion++;
+        this->spriteVersion++;
         memcpy(&this->ctx.stat, stat, sizeof(stat));
         memcpy(&this->ctx.reg, reg, sizeof(reg));
         this->ctx.hardwareResetFlag = 0xFF;
@@ -348,10 +486,18 @@ class V9958
     {
         this->ctx.stat[0] &= 0b11100000;
         this->ctx.stat[0] |= (f ? 0b01000000 : 0) | (n & 0b00011111);
+        if (this->lineLog) {
+            this->lineLog->sprite5S = f || 0 < this->lineLog->sprite5S ? 1 : 0;
+            this->lineLog->spriteN = n;
+        }
     }
 
     inline void setCollision(int x, int y)
     {
+        if (this->lineLog) {
+            this->lineLog->collisionX = x;
+            this->lineLog->collisionY = y;
+        }
         this->ctx.stat[0] |= 0b00100000;
         x += 12;
         y += 8;
@@ -408,6 +554,119 @@ class V9958
         return addr;
     }
 
+    // invalidate the sprite cache if the written VRAM (addr to addr + size - 1) overlaps the sprite tables (mode 2)
+    inline void checkSpriteTableWrite(int addr, int size = 1)
+    {
+        int ct = this->getSpriteColorTable();
+        int end = this->max(ct + 512, this->getSpriteAttributeTableM2() + 128);
+        int sg = this->getSpriteGeneratorTable();
+        if ((addr < end && ct < addr + size) || (addr < sg + 2048 && sg < addr + size)) {
+            this->spriteVersion++;
+        }
+    }
+
+    // mark the written VRAM (addr to addr + size - 1) as changed for lazyRendering and the sprite cache
+    inline void setVramChanged(int addr, int size = 1)
+    {
+        if (0 == ++this->vramVersion) {
+            memset(this->vramPageVersion, 0, sizeof(this->vramPageVersion));
+            this->vramVersion = 1;
+            this->renderVersion++; // the versions of all scanlines are discarded
+        }
+        for (int page = addr >> 8; page <= (addr + size - 1) >> 8; page++) {
+            this->vramPageVersion[page & 0x1FF] = this->vramVersion;
+        }
+        this->checkSpriteTableWrite(addr, size);
+    }
+
+    // check whether VRAM (addr to addr + size - 1) was written after the vramVersion
+    inline bool isVramChanged(int addr, int size, unsigned int since)
+    {
+        for (int page = addr >> 8; page <= (addr + size - 1) >> 8; page++) {
+            if (since < this->vramPageVersion[page & 0x1FF]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // check whether VRAM that the scanline reads (name, pattern, color and sprite tables) was written after the vramVersion
+    inline bool isScanlineVramChanged(int scanline, unsigned int since)
+    {
+        if (since == this->vramVersion) {
+            return false;
+        }
+        int lineNumber = scanline - (this->getTopBorder() - this->getAdjustY());
+        if (lineNumber < 0 || this->getLineNumber() <= lineNumber || !this->isEnabledScreen()) {
+            return false; // border or blank: VRAM is not read
+        }
+        int lineNumberS = (lineNumber + this->ctx.reg[23]) & 0xFF;
+        int pn = this->getNameTableAddress();
+        bool spriteMode2 = true;
+        switch (this->getScreenMode()) {
+            case 0b00011: // GRAPHIC4
+            case 0b00100: // GRAPHIC5
+            case 0b00101: // GRAPHIC6
+            case 0b00111: // GRAPHIC7
+            {
+                int lineBytes = this->getScreenMode() < 0b00101 ? 128 : 256;
+                int pageBit = lineBytes << 8;
+                int addr = pn + lineNumberS * lineBytes;
+                if (this->getSP2() || this->isEvenOrderMode()) {
+                    // both pages can be displayed
+                    if (this->isVramChanged(addr & ~pageBit, lineBytes, since) || this->isVramChanged(addr | pageBit, lineBytes, since)) {
+                        return true;
+                    }
+                } else if (this->isVramChanged(addr, lineBytes, since)) {
+                    return true;
+                }
+                break;
+            }
+            case 0b00000: // GRAPHIC1
+                if (this->isVramChanged(pn + lineNumberS / 8 * 32, 32, since)) {
+                    return true;
+                }
+                spriteMode2 = false;
+                break;
+            case 0b00001: // GRAPHIC2
+            case 0b00010: // GRAPHIC3
+                // the scanlines scrolled to 192-255 read the 4th block (8KB) of the pattern generator and the color table
+                if (this->isVramChanged(pn + lineNumberS / 8 * 32, 32, since) ||
+                    (this->getSP2() && this->isVramChanged(pn + 1024 + lineNumberS / 8 * 32, 32, since)) ||
+                    this->isVramChanged(this->getPatternGeneratorAddress(), 0x2000, since) ||
+                    this->isVramChanged(this->getColorTableAddress(), 0x2000, since)) {
+                    return true;
+                }
+                spriteMode2 = 0b00010 == this->getScreenMode();
+                break;
+            case 0b01000: // MULTI COLOR
+                if (this->isVramChanged(pn + lineNumber / 8 * 32, 32, since)) {
+                    return true;
+                }
+                spriteMode2 = false;
+                break;
+            case 0b10000: // TEXT1
+                return this->isVramChanged(pn + lineNumberS / 8 * 40, 40, since) ||
+                       this->isVramChanged(this->getPatternGeneratorAddress(), this->getPatternGeneratorSize(), since);
+            case 0b10010: // TEXT2
+                return this->isVramChanged(pn + lineNumberS / 8 * 80, 80, since) ||
+                       this->isVramChanged(this->getPatternGeneratorAddress(), this->getPatternGeneratorSize(), since);
+            default:
+                return false;
+        }
+        if (this->isVramChanged(this->getPatternGeneratorAddress(), this->getPatternGeneratorSize(), since) ||
+            this->isVramChanged(this->getColorTableAddress(), this->getColorTableSize(), since) ||
+            this->isVramChanged(this->getSpriteGeneratorTable(), 2048, since)) {
+            return true;
+        }
+        if (spriteMode2) {
+            int ct = this->getSpriteColorTable();
+            return this->isVramChanged(ct, this->max(ct + 512, this->getSpriteAttributeTableM2() + 128) - ct, since);
+        } else {
+            return this->isVramChanged(this->getSpriteAttributeTableM1(), 128, since);
+        }
+    }
+
     inline int getAddressMask()
     {
         switch (this->getScreenMode()) {
@@ -554,29 +813,41 @@ class V9958
         }
     }
 
+    inline bool isTickCommand()
+    {
+        switch (this->ctx.command) {
+            case 0b1101: return true; // HMMM
+            case 0b1100: return true; // HMMV
+            case 0b1001: return true; // LMMM
+            case 0b1000: return true; // LMMV
+            case 0b0111: return true; // LINE
+            case 0b0110: return true; // SRCH
+            case 0b0101: return true; // PSET
+            case 0b0100: return true; // POINT
+            default: return false;
+        }
+    }
+
     inline void tick(int tickCount)
     {
-        for (int i = 0; i < tickCount; i++) {
-            // execute command
-            if (this->ctx.cmd.wait) {
-                this->ctx.cmd.wait--;
+        while (0 < tickCount) {
+            // skip to the next horizontal event
+            int n = this->evt.hn[this->ctx.countH];
+            if (tickCount < n) {
+                n = tickCount;
             }
-            if (this->ctx.command && 0 == this->ctx.cmd.wait) {
-                switch (this->ctx.command) {
-                    case 0b1101: this->executeCommandHMMM(false); break;
-                    case 0b1100: this->executeCommandHMMV(false); break;
-                    case 0b1001: this->executeCommandLMMM(false); break;
-                    case 0b1000: this->executeCommandLMMV(false); break;
-                    case 0b0111: this->executeCommandLINE(false); break;
-                    case 0b0110: this->executeCommandSRCH(false); break;
-                    case 0b0101: this->executeCommandPSET(false); break;
-                    case 0b0100: this->executeCommandPOINT(false); break;
-                }
+            tickCount -= n;
+
+            // command is executed lazily by syncCommand
+            if (this->isTickCommand()) {
+                this->commandDots += n;
+            } else if (this->ctx.cmd.wait) {
+                this->ctx.cmd.wait -= this->min(this->ctx.cmd.wait, n);
             }
 
             // count up (H)
             auto htPrev = this->evt.ht[this->ctx.countH];
-            this->ctx.countH++;
+            this->ctx.countH += n;
             this->ctx.countH %= 1368;
             if (htPrev != this->evt.ht[this->ctx.countH]) {
                 tick_checkHorizontalEvents();
@@ -584,6 +855,34 @@ class V9958
         }
     }
 
+    inline void syncCommand()
+    {
+        while (this->commandDots && this->isTickCommand()) {
+            int need = this->ctx.cmd.wait ? this->ctx.cmd.wait : 1;
+            if (this->commandDots < need) {
+                this->ctx.cmd.wait -= this->commandDots;
+                this->commandDots = 0;
+                return;
+            }
+            this->commandDots -= need;
+            this->ctx.cmd.wait = 0;
+            switch (this->ctx.command) {
+                case 0b1101: this->executeCommandHMMMSpan(); break;
+                case 0b1100: this->executeCommandHMMVSpan(); break;
+                case 0b1001: this->executeCommandLMMMSpan(); break;
+                case 0b1000: this->executeCommandLMMVSpan(); break;
+                case 0b0111: this->executeCommandLINE(false); break;
+                case 0b0110: this->executeCommandSRCH(false); break;
+                case 0b0101: this->executeCommandPSET(false); break;
+                case 0b0100: this->executeCommandPOINT(false); break;
+            }
+        }
+        if (this->commandDots) {
+            this->ctx.cmd.wait -= this->min(this->ctx.cmd.wait, this->commandDots);
+            this->commandDots = 0;
+        }
+    }
+
     inline void tick_checkHorizontalEvents()
     {
         switch (this->evt.ht[this->ctx.countH]) {
@@ -624,6 +923,9 @@ class V9958
         switch (this->evt.vt[this->ctx.countV]) {
             case VerticalEventType::VerticalSync:
                 this->ctx.counter++;
+                if (this->isEvenOrderMode()) {
+                    this->renderVersion++; // the page to be displayed is changed
+                }
                 this->detectBreak(this->arg);
                 break;
             case VerticalEventType::TopErase:
@@ -644,15 +946,12 @@ class V9958
 
     inline int displayWidth()
     {
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-        return 284;
-#else
-        return 568;
-#endif
+        return this->halfHorizontal ? 284 : 568;
     }
 
     inline void tick_display()
     {
+        this->syncCommand();
         int scanline = this->evt.vi[this->ctx.countV] - this->getAdjustY();
         switch (this->evt.vt[this->ctx.countV]) {
             case VerticalEventType::TopBorder:
@@ -670,40 +969,165 @@ class V9958
         } else if (240 <= scanline) {
             return;
         }
+        if (this->skipRendering) {
+            this->renderVersion++; // display is not updated
+            if (this->getTopBorder() - this->getAdjustY() <= scanline) {
+                this->evaluateScanline(scanline - (this->getTopBorder() - this->getAdjustY()));
+            }
+            return;
+        }
+        if (this->lazyRendering) {
+            auto cache = &this->lineCache[scanline];
+            if (cache->version == this->renderVersion && cache->limitOverSprites == this->renderLimitOverSprites && !this->isScanlineVramChanged(scanline, cache->vramVersion)) {
+                this->replayLineCache(cache);
+                this->outputScanline(scanline);
+                return;
+            }
+            cache->version = this->renderVersion;
+            cache->vramVersion = this->vramVersion;
+            cache->limitOverSprites = this->renderLimitOverSprites;
+            cache->lastRenderScanline = -1;
+            cache->sprite5S = -1;
+            cache->collisionX = -1;
+            this->lineLog = cache;
+        }
         // render backdrop
         auto renderPosition = &this->display[scanline * this->displayWidth()];
         if (0b00100 == this->getScreenMode()) {
             unsigned short ec = this->palette[(this->ctx.reg[7] & 0b00001100) >> 2];
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-            for (int x = 0; x < 284; x++) {
-                renderPosition[x] = ec;
-            }
-#else
-            unsigned short oc = this->palette[this->ctx.reg[7] & 0b00000011];
-            for (int x = 0; x < 568; x += 2) {
-                renderPosition[x] = ec;
-                renderPosition[x + 1] = oc;
+            if (this->halfHorizontal) {
+                this->fillPixels(renderPosition, 284, ec);
+            } else {
+                unsigned short oc = this->palette[this->ctx.reg[7] & 0b00000011];
+                for (int x = 0; x < 568; x += 2) {
+                    renderPosition[x] = ec;
+                    renderPosition[x + 1] = oc;
+                }
             }
-#endif
         } else {
-            unsigned short bc = this->getBackdropColor();
-            for (int x = 0; x < this->displayWidth(); x++) {
-                renderPosition[x] = bc;
-            }
+            this->fillPixels(renderPosition, this->displayWidth(), this->getBackdropColor());
         }
         // render main display
         if (this->getTopBorder() - this->getAdjustY() <= scanline) {
             int renderLine = scanline - (this->getTopBorder() - this->getAdjustY());
             if (renderLine < this->getLineNumber()) {
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-                this->renderScanline(renderLine, &renderPosition[13 - this->getAdjustX()]);
-#else
-                this->renderScanline(renderLine, &renderPosition[26 - (this->getAdjustX() << 1)]);
+                if (this->halfHorizontal) {
+                    this->renderScanline<true>(renderLine, &renderPosition[13 - this->getAdjustX()]);
+                } else {
+                    this->renderScanline<false>(renderLine, &renderPosition[26 - (this->getAdjustX() << 1)]);
+                }
+            }
+        }
+        this->lineLog = nullptr;
+        this->outputScanline(scanline);
+    }
+
+    inline void outputScanline(int scanline)
+    {
+        if (!this->output.pixels) {
+            return;
+        }
+        int width = this->displayWidth();
+        auto src = &this->display[scanline * width];
+        auto dst = this->output.pixels + scanline * this->output.pitch;
+        if (this->output.format < 2) {
+            auto dst16 = (unsigned short*)dst;
+            for (int x = 0; x < width; x++) {
+                dst16[x] = (unsigned short)(this->output.lo[src[x] & 0xFF] | this->output.hi[src[x] >> 8]);
+            }
+        } else {
+            auto dst32 = (unsigned int*)dst;
+            int x = 0;
+#ifdef V9958_SIMD
+            x = this->expandDisplayPixels(src, dst32, width);
 #endif
+            for (; x < width; x++) {
+                dst32[x] = this->output.lo[src[x] & 0xFF] | this->output.hi[src[x] >> 8];
             }
         }
     }
 
+#if defined(V9958_SIMD_AVX2) || defined(V9958_SIMD_SSSE3)
+    // convert 8 display pixels at once to XRGB8888 or RGBA8888 (same as convertDisplayPixel) and returns the converted pixels
+    inline int expandDisplayPixels(const unsigned short* src, unsigned int* dst, int width)
+    {
+        const __m128i m5 = _mm_set1_epi16(0x1F);
+        const __m128i mg = _mm_set1_epi16(this->colorMode ? 0x3F : 0x1F);
+        const __m128i rs = _mm_cvtsi32_si128(10 + this->colorMode);
+        const __m128i gl = _mm_cvtsi32_si128(3 - this->colorMode);
+        const __m128i gr = _mm_cvtsi32_si128(2 + this->colorMode * 2);
+        bool rgba = 3 == this->output.format;
+        const __m128i a = _mm_set1_epi16(rgba ? 0x00FF : (short)0xFF00);
+        int x = 0;
+        for (; x + 8 <= width; x += 8) {
+            __m128i c = _mm_loadu_si128((const __m128i*)&src[x]);
+            __m128i r = _mm_and_si128(_mm_srl_epi16(c, rs), m5);
+            __m128i g = _mm_and_si128(_mm_srli_epi16(c, 5), mg);
+            __m128i b = _mm_and_si128(c, m5);
+            r = _mm_or_si128(_mm_slli_epi16(r, 3), _mm_srli_epi16(r, 2));
+            g = _mm_or_si128(_mm_sll_epi16(g, gl), _mm_srl_epi16(g, gr));
+            b = _mm_or_si128(_mm_slli_epi16(b, 3), _mm_srli_epi16(b, 2));
+            // lower and upper 16 bits of each output pixel
+            __m128i lo, hi;
+            if (rgba) {
+                lo = _mm_or_si128(_mm_slli_epi16(b, 8), a);
+                hi = _mm_or_si128(_mm_slli_epi16(r, 8), g);
+            } else {
+                lo = _mm_or_si128(_mm_slli_epi16(g, 8), b);
+                hi = _mm_or_si128(r, a);
+            }
+            _mm_storeu_si128((__m128i*)&dst[x], _mm_unpacklo_epi16(lo, hi));
+            _mm_storeu_si128((__m128i*)&dst[x + 4], _mm_unpackhi_epi16(lo, hi));
+        }
+        return x;
+    }
+#elif defined(V9958_SIMD_NEON)
+    // convert 8 display pixels at once to XRGB8888 or RGBA8888 (same as convertDisplayPixel) and returns the converted pixels
+    inline int expandDisplayPixels(const unsigned short* src, unsigned int* dst, int width)
+    {
+        const uint16x8_t m5 = vdupq_n_u16(0x1F);
+        const uint16x8_t mg = vdupq_n_u16(this->colorMode ? 0x3F : 0x1F);
+        const int16x8_t rs = vdupq_n_s16(-(10 + this->colorMode));
+        const int16x8_t gl = vdupq_n_s16(3 - this->colorMode);
+        const int16x8_t gr = vdupq_n_s16(-(2 + this->colorMode * 2));
+        bool rgba = 3 == this->output.format;
+        const uint16x8_t a = vdupq_n_u16(rgba ? 0x00FF : 0xFF00);
+        int x = 0;
+        for (; x + 8 <= width; x += 8) {
+            uint16x8_t c = vld1q_u16(&src[x]);
+            uint16x8_t r = vandq_u16(vshlq_u16(c, rs), m5);
+            uint16x8_t g = vandq_u16(vshrq_n_u16(c, 5), mg);
+            uint16x8_t b = vandq_u16(c, m5);
+            r = vorrq_u16(vshlq_n_u16(r, 3), vshrq_n_u16(r, 2));
+            g = vorrq_u16(vshlq_u16(g, gl), vshlq_u16(g, gr));
+            b = vorrq_u16(vshlq_n_u16(b, 3), vshrq_n_u16(b, 2));
+            // lower and upper 16 bits of each output pixel
+            uint16x8x2_t z;
+            if (rgba) {
+                z = vzipq_u16(vorrq_u16(vshlq_n_u16(b, 8), a), vorrq_u16(vshlq_n_u16(r, 8), g));
+            } else {
+                z = vzipq_u16(vorrq_u16(vshlq_n_u16(g, 8), b), vorrq_u16(r, a));
+            }
+            vst1q_u32(&dst[x], vreinterpretq_u32_u16(z.val[0]));
+            vst1q_u32(&dst[x + 4], vreinterpretq_u32_u16(z.val[1]));
+        }
+        return x;
+    }
+#endif
+
+    inline void replayLineCache(LineCache* cache)
+    {
+        if (0 <= cache->lastRenderScanline) {
+            this->lastRenderScanline = cache->lastRenderScanline;
+        }
+        if (0 <= cache->sprite5S) {
+            this->set5S(cache->sprite5S, cache->spriteN);
+        }
+        if (0 <= cache->collisionX) {
+            this->setCollision(cache->collisionX, cache->collisionY);
+        }
+    }
+
     inline void tick_checkIntH()
     {
         if (!this->isFH()) {
@@ -732,6 +1156,7 @@ class V9958
 
     inline unsigned char inPort98()
     {
+        this->syncCommand();
         unsigned char result = this->ctx.readBuffer;
         this->readVideoMemory();
         this->ctx.latch1 = 0;
@@ -740,6 +1165,7 @@ class V9958
 
     inline unsigned char inPort99()
     {
+        this->syncCommand();
         int sn = this->ctx.reg[15] & 0b00001111;
         unsigned char result = this->ctx.stat[sn];
         switch (sn) {
@@ -781,14 +1207,17 @@ class V9958
 
     inline void outPort98(unsigned char value)
     {
+        this->syncCommand();
         this->ctx.readBuffer = value;
         this->ctx.ram[this->ctx.addr] = this->ctx.readBuffer;
+        this->setVramChanged(this->ctx.addr);
         this->incrementAddress();
         this->ctx.latch1 = 0;
     }
 
     inline void outPort99(unsigned char value)
     {
+        this->syncCommand();
         this->ctx.latch1 &= 1;
         this->ctx.tmpAddr[this->ctx.latch1++] = value;
         if (2 == this->ctx.latch1) {
@@ -818,6 +1247,7 @@ class V9958
 
     inline void outPort9B(unsigned char value)
     {
+        this->syncCommand();
         unsigned char r17 = this->ctx.reg[17];
         if (17 != (r17 & 0b00111111)) {
             this->updateRegister(r17 & 0b00111111, value);
@@ -912,6 +1342,7 @@ class V9958
                 b = 0;
         }
         this->palette[pn] = r | g | b;
+        this->renderVersion++;
     }
 
     inline const char* where(int addr)
@@ -1003,6 +1434,12 @@ class V9958
         value &= this->regMask[rn];
         unsigned char mod = this->ctx.reg[rn] ^ value;
         this->ctx.reg[rn] = value;
+        if (mod && rn < 32 && rn != 14 && rn != 15 && rn != 16 && rn != 17 && rn != 19) {
+            this->renderVersion++;
+            if (rn < 2 || rn == 5 || rn == 6 || rn == 11 || rn == 23) {
+                this->spriteVersion++;
+            }
+        }
         switch (rn) {
             case 0:
                 if (mod & 0x10) {
@@ -1056,10 +1493,14 @@ class V9958
         }
     }
 
+    template <bool HALF>
     inline void renderScanline(int lineNumber, unsigned short* renderPosition)
     {
         if (0 <= lineNumber && lineNumber < this->getLineNumber()) {
             this->lastRenderScanline = lineNumber;
+            if (this->lineLog) {
+                this->lineLog->lastRenderScanline = lineNumber;
+            }
             if (this->isEnabledScreen()) {
                 // 00 000 : GRAPHIC1    256x192             Mode1   chr           16KB
                 // 00 001 : GRAPHIC2    256x192             Mode1   chr           16KB
@@ -1073,34 +1514,34 @@ class V9958
                 // 10 010 : TEXT2       80x24 (6x8px/block) n/a     chr           16KB
                 switch (this->getScreenMode()) {
                     case 0b00000: // GRAPHIC1
-                        this->renderScanlineModeG1(lineNumber, renderPosition);
+                        this->renderScanlineModeG1<HALF>(lineNumber, renderPosition);
                         break;
                     case 0b00001: // GRAPHIC2
-                        this->renderScanlineModeG23(lineNumber, false, renderPosition);
+                        this->renderScanlineModeG23<HALF>(lineNumber, false, renderPosition);
                         break;
                     case 0b00010: // GRAPHIC3
-                        this->renderScanlineModeG23(lineNumber, true, renderPosition);
+                        this->renderScanlineModeG23<HALF>(lineNumber, true, renderPosition);
                         break;
                     case 0b00011: // GRAPHIC4
-                        this->renderScanlineModeG4(lineNumber, renderPosition);
+                        this->renderScanlineModeG4<HALF>(lineNumber, renderPosition);
                         break;
                     case 0b00100: // GRAPHIC5
-                        this->renderScanlineModeG5(lineNumber, renderPosition);
+                        this->renderScanlineModeG5<HALF>(lineNumber, renderPosition);
                         break;
                     case 0b00101: // GRAPHIC6
-                        this->renderScanlineModeG6(lineNumber, renderPosition);
+                        this->renderScanlineModeG6<HALF>(lineNumber, renderPosition);
                         break;
                     case 0b00111: // GRAPHIC7
-                        this->renderScanlineModeG7(lineNumber, renderPosition);
+                        this->renderScanlineModeG7<HALF>(lineNumber, renderPosition);
                         break;
                     case 0b01000: // MULTI COLOR
-                        this->renderScanlineModeMC(lineNumber, renderPosition);
+                        this->renderScanlineModeMC<HALF>(lineNumber, renderPosition);
                         break;
                     case 0b10000: // TEXT1
-                        this->renderScanlineModeT1(lineNumber, renderPosition);
+                        this->renderScanlineModeT1<HALF>(lineNumber, renderPosition);
                         break;
                     case 0b10010: // TEXT2
-                        this->renderScanlineModeT2(lineNumber, renderPosition);
+                        this->renderScanlineModeT2<HALF>(lineNumber, renderPosition);
                         break;
                     case 0b11011: // ???
                         break;
@@ -1110,33 +1551,463 @@ class V9958
                         return;
                 }
                 if (this->isMaskLeft8px()) {
-                    auto borderColor = this->getBackdropColor();
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-                    for (int i = 0; i < 8; i++) {
-                        renderPosition[i] = borderColor;
-                    }
-#else
-                    for (int i = 0; i < 16; i++) {
-                        renderPosition[i] = borderColor;
-                    }
-#endif
+                    this->fillPixels(renderPosition, HALF ? 8 : 16, this->getBackdropColor());
                 }
             } else
                 return;
         }
     }
 
+    inline void evaluateScanline(int lineNumber)
+    {
+        if (0 <= lineNumber && lineNumber < this->getLineNumber()) {
+            this->lastRenderScanline = lineNumber;
+            if (this->isEnabledScreen()) {
+                switch (this->getScreenMode()) {
+                    case 0b00000: // GRAPHIC1
+                    case 0b00001: // GRAPHIC2
+                    case 0b01000: // MULTI COLOR
+                        this->renderSpritesMode1<false>(lineNumber, nullptr);
+                        break;
+                    case 0b00010: // GRAPHIC3
+                    case 0b00011: // GRAPHIC4
+                    case 0b00100: // GRAPHIC5
+                    case 0b00101: // GRAPHIC6
+                    case 0b00111: // GRAPHIC7
+                        this->renderSpritesMode2<false>(lineNumber, nullptr);
+                        break;
+                }
+            }
+        }
+    }
+
     inline void renderPixel1(unsigned short* renderPosition, int paletteNumber)
     {
         if (0 == (this->ctx.reg[8] & 0b00100000) && !paletteNumber) return;
         *renderPosition = this->palette[paletteNumber];
     }
 
+    inline void storePixel2(unsigned short* renderPosition, unsigned short color)
+    {
+        // write the doubled pixel with a single 32bit store
+        unsigned int color2 = color * 0x10001U;
+        memcpy(renderPosition, &color2, 4);
+    }
+
+    inline void fillPixels(unsigned short* renderPosition, int width, unsigned short color)
+    {
+        int x = 0;
+        for (; x + 1 < width; x += 2) {
+            this->storePixel2(&renderPosition[x], color);
+        }
+        if (x < width) {
+            renderPosition[x] = color;
+        }
+    }
+
+#ifdef V9958_SIMD
+    // copy the bytes of a bitmap scanline that starts at addr + x (x wraps at lineSize and calls wrapAddress)
+    template <typename WrapAddress>
+    inline unsigned char* gatherBitmapLine(int addr, int x, int lineSize, WrapAddress wrapAddress)
+    {
+        unsigned char* line = this->bitmapLine;
+        line[0] = this->ctx.ram[(addr + x) & 0x1FFFF];
+        x = (x + 1) & (lineSize - 1);
+        if (0 == x) {
+            addr = wrapAddress(addr);
+        }
+        for (int n = 1; n < lineSize;) {
+            int len = lineSize - x < lineSize - n ? lineSize - x : lineSize - n;
+            memcpy(&line[n], &this->ctx.ram[addr + x], len);
+            n += len;
+            x = (x + len) & (lineSize - 1);
+            if (0 == x) {
+                addr = wrapAddress(addr);
+            }
+        }
+        return line;
+    }
+
+    inline void updateBitmapLUT(bool isGraphic7)
+    {
+        for (int n = 0; n < 16; n++) {
+            unsigned short c0 = isGraphic7 ? this->convertColor_8bit_to_16bit(n) : this->palette[n];
+            unsigned short c1 = isGraphic7 ? this->convertColor_8bit_to_16bit(n << 4) : 0;
+            this->bitmapLUT.lo[0][n] = c0 & 0xFF;
+            this->bitmapLUT.hi[0][n] = c0 >> 8;
+            this->bitmapLUT.lo[1][n] = c1 & 0xFF;
+            this->bitmapLUT.hi[1][n] = c1 >> 8;
+        }
+    }
+
+#if defined(V9958_SIMD_NEON)
+    static inline uint8x16_t lookup16(uint8x16_t table, uint8x16_t index)
+    {
+#if defined(__aarch64__)
+        return vqtbl1q_u8(table, index);
+#else
+        uint8x8x2_t t = {{vget_low_u8(table), vget_high_u8(table)}};
+        return vcombine_u8(vtbl2_u8(t, vget_low_u8(index)), vtbl2_u8(t, vget_high_u8(index)));
+#endif
+    }
+#endif
+
+    // expand the source bytes to the indices of the output pixels (16 source bytes per iteration)
+    inline unsigned char* expandBitmapLine(const unsigned char* src, int mode, bool half)
+    {
+        unsigned char* dst = this->bitmapIndex;
+        int size = mode < 6 ? 128 : 256; // GRAPHIC4,5: 128 bytes, GRAPHIC6,7: 256 bytes
+        for (int i = 0; i < size; i += 16) {
+#if defined(V9958_SIMD_NEON)
+            uint8x16_t v = vld1q_u8(&src[i]);
+            uint8x16_t m3 = vdupq_n_u8(0x03);
+            switch (mode) {
+                case 4: { // GRAPHIC4: 2 pixels per byte
+                    uint8x16x2_t p = vzipq_u8(vshrq_n_u8(v, 4), vandq_u8(v, vdupq_n_u8(0x0F)));
+                    if (half) {
+                        vst1q_u8(dst, p.val[0]);
+                        vst1q_u8(dst + 16, p.val[1]);
+                        dst += 32;
+                    } else {
+                        uint8x16x2_t p0 = vzipq_u8(p.val[0], p.val[0]);
+                        uint8x16x2_t p1 = vzipq_u8(p.val[1], p.val[1]);
+                        vst1q_u8(dst, p0.val[0]);
+                        vst1q_u8(dst + 16, p0.val[1]);
+                        vst1q_u8(dst + 32, p1.val[0]);
+                        vst1q_u8(dst + 48, p1.val[1]);
+                        dst += 64;
+                    }
+                    break;
+                }
+                case 5: { // GRAPHIC5: 4 pixels per byte
+                    uint8x16_t f6 = vshrq_n_u8(v, 6);
+                    uint8x16_t f2 = vandq_u8(vshrq_n_u8(v, 2), m3);
+                    if (half) {
+                        uint8x16x2_t p = vzipq_u8(f6, f2);
+                        vst1q_u8(dst, p.val[0]);
+                        vst1q_u8(dst + 16, p.val[1]);
+                        dst += 32;
+                    } else {
+                        uint8x16x2_t a = vzipq_u8(f6, vandq_u8(vshrq_n_u8(v, 4), m3));
+                        uint8x16x2_t c = vzipq_u8(f2, vandq_u8(v, m3));
+                        uint16x8x2_t p0 = vzipq_u16(vreinterpretq_u16_u8(a.val[0]), vreinterpretq_u16_u8(c.val[0]));
+                        uint16x8x2_t p1 = vzipq_u16(vreinterpretq_u16_u8(a.val[1]), vreinterpretq_u16_u8(c.val[1]));
+                        vst1q_u8(dst, vreinterpretq_u8_u16(p0.val[0]));
+                        vst1q_u8(dst + 16, vreinterpretq_u8_u16(p0.val[1]));
+                        vst1q_u8(dst + 32, vreinterpretq_u8_u16(p1.val[0]));
+                        vst1q_u8(dst + 48, vreinterpretq_u8_u16(p1.val[1]));
+                        dst += 64;
+                    }
+                    break;
+                }
+                case 6: { // GRAPHIC6: 2 pixels per byte (only the left pixel in half width)
+                    if (half) {
+                        vst1q_u8(dst, vshrq_n_u8(v, 4));
+                        dst += 16;
+                    } else {
+                        uint8x16x2_t p = vzipq_u8(vshrq_n_u8(v, 4), vandq_u8(v, vdupq_n_u8(0x0F)));
+                        vst1q_u8(dst, p.val[0]);
+                        vst1q_u8(dst + 16, p.val[1]);
+                        dst += 32;
+                    }
+                    break;
+                }
+                default: { // GRAPHIC7: 1 pixel per byte (doubled in full width)
+                    uint8x16x2_t p = vzipq_u8(v, v);
+                    vst1q_u8(dst, p.val[0]);
+                    vst1q_u8(dst + 16, p.val[1]);
+                    dst += 32;
+                    break;
+                }
+            }
+#else
+            __m128i v = _mm_loadu_si128((const __m128i*)&src[i]);
+            __m128i m3 = _mm_set1_epi8(0x03);
+            __m128i m15 = _mm_set1_epi8(0x0F);
+            switch (mode) {
+                case 4: { // GRAPHIC4: 2 pixels per byte
+                    __m128i h = _mm_and_si128(_mm_srli_epi16(v, 4), m15);
+                    __m128i l = _mm_and_si128(v, m15);
+                    __m128i p0 = _mm_unpacklo_epi8(h, l);
+                    __m128i p1 = _mm_unpackhi_epi8(h, l);
+                    if (half) {
+                        _mm_storeu_si128((__m128i*)dst, p0);
+                        _mm_storeu_si128((__m128i*)(dst + 16), p1);
+                        dst += 32;
+                    } else {
+                        _mm_storeu_si128((__m128i*)dst, _mm_unpacklo_epi8(p0, p0));
+                        _mm_storeu_si128((__m128i*)(dst + 16), _mm_unpackhi_epi8(p0, p0));
+                        _mm_storeu_si128((__m128i*)(dst + 32), _mm_unpacklo_epi8(p1, p1));
+                        _mm_storeu_si128((__m128i*)(dst + 48), _mm_unpackhi_epi8(p1, p1));
+                        dst += 64;
+                    }
+                    break;
+                }
+                case 5: { // GRAPHIC5: 4 pixels per byte
+                    __m128i f6 = _mm_and_si128(_mm_srli_epi16(v, 6), m3);
+                    __m128i f2 = _mm_and_si128(_mm_srli_epi16(v, 2), m3);
+                    if (half) {
+                        _mm_storeu_si128((__m128i*)dst, _mm_unpacklo_epi8(f6, f2));
+                        _mm_storeu_si128((__m128i*)(dst + 16), _mm_unpackhi_epi8(f6, f2));
+                        dst += 32;
+                    } else {
+                        __m128i f4 = _mm_and_si128(_mm_srli_epi16(v, 4), m3);
+                        __m128i f0 = _mm_and_si128(v, m3);
+                        __m128i a0 = _mm_unpacklo_epi8(f6, f4);
+                        __m128i a1 = _mm_unpackhi_epi8(f6, f4);
+                        __m128i c0 = _mm_unpacklo_epi8(f2, f0);
+                        __m128i c1 = _mm_unpackhi_epi8(f2, f0);
+                        _mm_storeu_si128((__m128i*)dst, _mm_unpacklo_epi16(a0, c0));
+                        _mm_storeu_si128((__m128i*)(dst + 16), _mm_unpackhi_epi16(a0, c0));
+                        _mm_storeu_si128((__m128i*)(dst + 32), _mm_unpacklo_epi16(a1, c1));
+                        _mm_storeu_si128((__m128i*)(dst + 48), _mm_unpackhi_epi16(a1, c1));
+                        dst += 64;
+                    }
+                    break;
+                }
+                case 6: { // GRAPHIC6: 2 pixels per byte (only the left pixel in half width)
+                    __m128i h = _mm_and_si128(_mm_srli_epi16(v, 4), m15);
+                    if (half) {
+                        _mm_storeu_si128((__m128i*)dst, h);
+                        dst += 16;
+                    } else {
+                        __m128i l = _mm_and_si128(v, m15);
+                        _mm_storeu_si128((__m128i*)dst, _mm_unpacklo_epi8(h, l));
+                        _mm_storeu_si128((__m128i*)(dst + 16), _mm_unpackhi_epi8(h, l));
+                        dst += 32;
+                    }
+                    break;
+                }
+                default: { // GRAPHIC7: 1 pixel per byte (doubled in full width)
+                    _mm_storeu_si128((__m128i*)dst, _mm_unpacklo_epi8(v, v));
+                    _mm_storeu_si128((__m128i*)(dst + 16), _mm_unpackhi_epi8(v, v));
+                    dst += 32;
+                    break;
+                }
+            }
+#endif
+        }
+        return this->bitmapIndex;
+    }
+
+    // render count pixels: bitmapLUT[index] (the pixels of index 0 are not rendered if transparent)
+    inline void lookupBitmapPixels(unsigned short* renderPosition, const unsigned char* index, int count, bool transparent)
+    {
+        int i = 0;
+#if defined(V9958_SIMD_AVX2)
+        __m256i lo0 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)this->bitmapLUT.lo[0]));
+        __m256i lo1 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)this->bitmapLUT.lo[1]));
+        __m256i hi0 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)this->bitmapLUT.hi[0]));
+        __m256i hi1 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)this->bitmapLUT.hi[1]));
+        __m256i m15 = _mm256_set1_epi8(0x0F);
+        for (; i + 32 <= count; i += 32) {
+            __m256i v = _mm256_loadu_si256((const __m256i*)&index[i]);
+            __m256i l = _mm256_and_si256(v, m15);
+            __m256i h = _mm256_and_si256(_mm256_srli_epi16(v, 4), m15);
+            __m256i pl = _mm256_or_si256(_mm256_shuffle_epi8(lo0, l), _mm256_shuffle_epi8(lo1, h));
+            __m256i ph = _mm256_or_si256(_mm256_shuffle_epi8(hi0, l), _mm256_shuffle_epi8(hi1, h));
+            __m256i a = _mm256_unpacklo_epi8(pl, ph); // pixels 0-7, 16-23
+            __m256i b = _mm256_unpackhi_epi8(pl, ph); // pixels 8-15, 24-31
+            __m256i p0 = _mm256_permute2x128_si256(a, b, 0x20);
+            __m256i p1 = _mm256_permute2x128_si256(a, b, 0x31);
+            if (transparent) {
+                __m256i z = _mm256_cmpeq_epi8(v, _mm256_setzero_si256());
+                __m256i za = _mm256_unpacklo_epi8(z, z);
+                __m256i zb = _mm256_unpackhi_epi8(z, z);
+                __m256i z0 = _mm256_permute2x128_si256(za, zb, 0x20);
+                __m256i z1 = _mm256_permute2x128_si256(za, zb, 0x31);
+                p0 = _mm256_blendv_epi8(p0, _mm256_loadu_si256((const __m256i*)&renderPosition[i]), z0);
+                p1 = _mm256_blendv_epi8(p1, _mm256_loadu_si256((const __m256i*)&renderPosition[i + 16]), z1);
+            }
+            _mm256_storeu_si256((__m256i*)&renderPosition[i], p0);
+            _mm256_storeu_si256((__m256i*)&renderPosition[i + 16], p1);
+        }
+#elif defined(V9958_SIMD_SSSE3)
+        __m128i lo0 = _mm_loadu_si128((const __m128i*)this->bitmapLUT.lo[0]);
+        __m128i lo1 = _mm_loadu_si128((const __m128i*)this->bitmapLUT.lo[1]);
+        __m128i hi0 = _mm_loadu_si128((const __m128i*)this->bitmapLUT.hi[0]);
+        __m128i hi1 = _mm_loadu_si128((const __m128i*)this->bitmapLUT.hi[1]);
+        __m128i m15 = _mm_set1_epi8(0x0F);
+        for (; i + 16 <= count; i += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i*)&index[i]);
+            __m128i l = _mm_and_si128(v, m15);
+            __m128i h = _mm_and_si128(_mm_srli_epi16(v, 4), m15);
+            __m128i pl = _mm_or_si128(_mm_shuffle_epi8(lo0, l), _mm_shuffle_epi8(lo1, h));
+            __m128i ph = _mm_or_si128(_mm_shuffle_epi8(hi0, l), _mm_shuffle_epi8(hi1, h));
+            __m128i p0 = _mm_unpacklo_epi8(pl, ph);
+            __m128i p1 = _mm_unpackhi_epi8(pl, ph);
+            if (transparent) {
+                __m128i z = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+                __m128i z0 = _mm_unpacklo_epi8(z, z);
+                __m128i z1 = _mm_unpackhi_epi8(z, z);
+                p0 = _mm_or_si128(_mm_andnot_si128(z0, p0), _mm_and_si128(z0, _mm_loadu_si128((const __m128i*)&renderPosition[i])));
+                p1 = _mm_or_si128(_mm_andnot_si128(z1, p1), _mm_and_si128(z1, _mm_loadu_si128((const __m128i*)&renderPosition[i + 8])));
+            }
+            _mm_storeu_si128((__m128i*)&renderPosition[i], p0);
+            _mm_storeu_si128((__m128i*)&renderPosition[i + 8], p1);
+        }
+#elif defined(V9958_SIMD_NEON)
+        uint8x16_t lo0 = vld1q_u8(this->bitmapLUT.lo[0]);
+        uint8x16_t lo1 = vld1q_u8(this->bitmapLUT.lo[1]);
+        uint8x16_t hi0 = vld1q_u8(this->bitmapLUT.hi[0]);
+        uint8x16_t hi1 = vld1q_u8(this->bitmapLUT.hi[1]);
+        uint8x16_t m15 = vdupq_n_u8(0x0F);
+        for (; i + 16 <= count; i += 16) {
+            uint8x16_t v = vld1q_u8(&index[i]);
+            uint8x16_t l = vandq_u8(v, m15);
+            uint8x16_t h = vshrq_n_u8(v, 4);
+            uint8x16_t pl = vorrq_u8(lookup16(lo0, l), lookup16(lo1, h));
+            uint8x16_t ph = vorrq_u8(lookup16(hi0, l), lookup16(hi1, h));
+            uint8x16x2_t p = vzipq_u8(pl, ph);
+            if (transparent) {
+                uint8x16_t z = vceqq_u8(v, vdupq_n_u8(0));
+                uint8x16x2_t zz = vzipq_u8(z, z);
+                p.val[0] = vbslq_u8(zz.val[0], vld1q_u8((const uint8_t*)&renderPosition[i]), p.val[0]);
+                p.val[1] = vbslq_u8(zz.val[1], vld1q_u8((const uint8_t*)&renderPosition[i + 8]), p.val[1]);
+            }
+            vst1q_u8((uint8_t*)&renderPosition[i], p.val[0]);
+            vst1q_u8((uint8_t*)&renderPosition[i + 8], p.val[1]);
+        }
+#endif
+        for (; i < count; i++) {
+            int n = index[i];
+            if (transparent && !n) continue;
+            renderPosition[i] = (this->bitmapLUT.lo[0][n & 0x0F] | this->bitmapLUT.lo[1][n >> 4]) | (this->bitmapLUT.hi[0][n & 0x0F] | this->bitmapLUT.hi[1][n >> 4]) << 8;
+        }
+    }
+
+#if defined(V9958_SIMD_AVX2) || defined(V9958_SIMD_SSSE3)
+    // Y, J, K (16bit lanes) -> RGB555/565 (see convertColorYJK)
+    static inline __m128i convertColorYJK(__m128i y, __m128i j, __m128i k, __m128i shiftR, __m128i shiftG)
+    {
+        __m128i zero = _mm_setzero_si128();
+        __m128i limit = _mm_set1_epi16(31);
+        __m128i r = _mm_min_epi16(_mm_max_epi16(_mm_add_epi16(y, j), zero), limit);
+        __m128i g = _mm_min_epi16(_mm_max_epi16(_mm_add_epi16(y, k), zero), limit);
+        __m128i b = _mm_sub_epi16(_mm_sub_epi16(_mm_add_epi16(_mm_slli_epi16(y, 2), y), _mm_add_epi16(j, j)), k);
+        b = _mm_min_epi16(_mm_srli_epi16(_mm_max_epi16(b, zero), 2), limit);
+        return _mm_or_si128(_mm_or_si128(_mm_sll_epi16(r, shiftR), _mm_sll_epi16(g, shiftG)), b);
+    }
+#elif defined(V9958_SIMD_NEON)
+    // Y, J, K (16bit lanes) -> RGB555/565 (see convertColorYJK)
+    static inline uint16x8_t convertColorYJK(int16x8_t y, int16x8_t j, int16x8_t k, int16x8_t shiftR, int16x8_t shiftG)
+    {
+        int16x8_t zero = vdupq_n_s16(0);
+        int16x8_t limit = vdupq_n_s16(31);
+        int16x8_t r = vminq_s16(vmaxq_s16(vaddq_s16(y, j), zero), limit);
+        int16x8_t g = vminq_s16(vmaxq_s16(vaddq_s16(y, k), zero), limit);
+        int16x8_t b = vsubq_s16(vsubq_s16(vmulq_n_s16(y, 5), vaddq_s16(j, j)), k);
+        b = vminq_s16(vshrq_n_s16(vmaxq_s16(b, zero), 2), limit);
+        return vreinterpretq_u16_s16(vorrq_s16(vorrq_s16(vshlq_s16(r, shiftR), vshlq_s16(g, shiftG)), b));
+    }
+
+    // [a0, a1, a2, a3] -> [a0, a0, a0, a0, a1, a1, a1, a1], [a2, a2, a2, a2, a3, a3, a3, a3]
+    static inline int16x8x2_t spreadYjkGroups(int32x4_t a)
+    {
+        int16x4_t n = vmovn_s32(a);
+        int16x4x2_t z = vzip_s16(n, n);
+        int32x2x2_t z0 = vzip_s32(vreinterpret_s32_s16(z.val[0]), vreinterpret_s32_s16(z.val[0]));
+        int32x2x2_t z1 = vzip_s32(vreinterpret_s32_s16(z.val[1]), vreinterpret_s32_s16(z.val[1]));
+        int16x8x2_t result;
+        result.val[0] = vcombine_s16(vreinterpret_s16_s32(z0.val[0]), vreinterpret_s16_s32(z0.val[1]));
+        result.val[1] = vcombine_s16(vreinterpret_s16_s32(z1.val[0]), vreinterpret_s16_s32(z1.val[1]));
+        return result;
+    }
+#endif
+
+    // render a YJK scanline (256 bytes = 64 groups of 4 pixels)
+    // YAE pixels take the palette from bitmapLUT (updateBitmapLUT(false)) and are selected by a mask
+    inline void renderYjkPixels(unsigned short* renderPosition, const unsigned char* src, bool half)
+    {
+#if defined(V9958_SIMD_AVX2) || defined(V9958_SIMD_SSSE3)
+        __m128i lo0 = _mm_loadu_si128((const __m128i*)this->bitmapLUT.lo[0]);
+        __m128i hi0 = _mm_loadu_si128((const __m128i*)this->bitmapLUT.hi[0]);
+        __m128i shiftR = _mm_cvtsi32_si128(10 + this->colorMode);
+        __m128i shiftG = _mm_cvtsi32_si128(5 + this->colorMode);
+        __m128i yae = _mm_set1_epi8(this->isYAE() ? 0x08 : 0x00);
+        __m128i m7 = _mm_set1_epi32(0x07);
+        __m128i m38 = _mm_set1_epi32(0x38);
+        __m128i m20 = _mm_set1_epi32(0x20);
+        __m128i zero = _mm_setzero_si128();
+        for (int i = 0; i < 256; i += 16) {
+            __m128i v = _mm_loadu_si128((const __m128i*)&src[i]);
+            // K = Y1[2:0] << 3 | Y0[2:0], J = Y3[2:0] << 3 | Y2[2:0] (signed 6 bits)
+            __m128i k = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(v, 5), m38), _mm_and_si128(v, m7));
+            __m128i j = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(v, 21), m38), _mm_and_si128(_mm_srli_epi32(v, 16), m7));
+            k = _mm_sub_epi32(_mm_xor_si128(k, m20), m20);
+            j = _mm_sub_epi32(_mm_xor_si128(j, m20), m20);
+            __m128i jk = _mm_packs_epi32(j, k);
+            __m128i jj = _mm_unpacklo_epi16(jk, jk);
+            __m128i kk = _mm_unpackhi_epi16(jk, jk);
+            __m128i y = _mm_and_si128(_mm_srli_epi16(v, 3), _mm_set1_epi8(0x1F));
+            __m128i p0 = convertColorYJK(_mm_unpacklo_epi8(y, zero), _mm_unpacklo_epi32(jj, jj), _mm_unpacklo_epi32(kk, kk), shiftR, shiftG);
+            __m128i p1 = convertColorYJK(_mm_unpackhi_epi8(y, zero), _mm_unpackhi_epi32(jj, jj), _mm_unpackhi_epi32(kk, kk), shiftR, shiftG);
+            // YAE: Y[0] = 1 -> palette[Y[4:1]]
+            __m128i h = _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0F));
+            __m128i pl = _mm_shuffle_epi8(lo0, h);
+            __m128i ph = _mm_shuffle_epi8(hi0, h);
+            __m128i m = _mm_cmpeq_epi8(_mm_and_si128(v, yae), _mm_set1_epi8(0x08));
+            __m128i m0 = _mm_unpacklo_epi8(m, m);
+            __m128i m1 = _mm_unpackhi_epi8(m, m);
+            p0 = _mm_or_si128(_mm_andnot_si128(m0, p0), _mm_and_si128(m0, _mm_unpacklo_epi8(pl, ph)));
+            p1 = _mm_or_si128(_mm_andnot_si128(m1, p1), _mm_and_si128(m1, _mm_unpackhi_epi8(pl, ph)));
+            if (half) {
+                _mm_storeu_si128((__m128i*)&renderPosition[i], p0);
+                _mm_storeu_si128((__m128i*)&renderPosition[i + 8], p1);
+            } else {
+                _mm_storeu_si128((__m128i*)&renderPosition[i * 2], _mm_unpacklo_epi16(p0, p0));
+                _mm_storeu_si128((__m128i*)&renderPosition[i * 2 + 8], _mm_unpackhi_epi16(p0, p0));
+                _mm_storeu_si128((__m128i*)&renderPosition[i * 2 + 16], _mm_unpacklo_epi16(p1, p1));
+                _mm_storeu_si128((__m128i*)&renderPosition[i * 2 + 24], _mm_unpackhi_epi16(p1, p1));
+            }
+        }
+#elif defined(V9958_SIMD_NEON)
+        uint8x16_t lo0 = vld1q_u8(this->bitmapLUT.lo[0]);
+        uint8x16_t hi0 = vld1q_u8(this->bitmapLUT.hi[0]);
+        int16x8_t shiftR = vdupq_n_s16(10 + this->colorMode);
+        int16x8_t shiftG = vdupq_n_s16(5 + this->colorMode);
+        uint8x16_t yae = vdupq_n_u8(this->isYAE() ? 0x08 : 0x00);
+        uint32x4_t m7 = vdupq_n_u32(0x07);
+        uint32x4_t m38 = vdupq_n_u32(0x38);
+        uint32x4_t m20 = vdupq_n_u32(0x20);
+        for (int i = 0; i < 256; i += 16) {
+            uint8x16_t v = vld1q_u8(&src[i]);
+            // K = Y1[2:0] << 3 | Y0[2:0], J = Y3[2:0] << 3 | Y2[2:0] (signed 6 bits)
+            uint32x4_t w = vreinterpretq_u32_u8(v);
+            uint32x4_t k = vorrq_u32(vandq_u32(vshrq_n_u32(w, 5), m38), vandq_u32(w, m7));
+            uint32x4_t j = vorrq_u32(vandq_u32(vshrq_n_u32(w, 21), m38), vandq_u32(vshrq_n_u32(w, 16), m7));
+            int16x8x2_t kk = spreadYjkGroups(vsubq_s32(vreinterpretq_s32_u32(veorq_u32(k, m20)), vreinterpretq_s32_u32(m20)));
+            int16x8x2_t jj = spreadYjkGroups(vsubq_s32(vreinterpretq_s32_u32(veorq_u32(j, m20)), vreinterpretq_s32_u32(m20)));
+            uint8x16_t y = vshrq_n_u8(v, 3);
+            uint16x8_t p0 = convertColorYJK(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(y))), jj.val[0], kk.val[0], shiftR, shiftG);
+            uint16x8_t p1 = convertColorYJK(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(y))), jj.val[1], kk.val[1], shiftR, shiftG);
+            // YAE: Y[0] = 1 -> palette[Y[4:1]]
+            uint8x16_t h = vshrq_n_u8(v, 4);
+            uint8x16x2_t pal = vzipq_u8(lookup16(lo0, h), lookup16(hi0, h));
+            uint8x16_t m = vtstq_u8(v, yae);
+            uint8x16x2_t mm = vzipq_u8(m, m);
+            p0 = vbslq_u16(vreinterpretq_u16_u8(mm.val[0]), vreinterpretq_u16_u8(pal.val[0]), p0);
+            p1 = vbslq_u16(vreinterpretq_u16_u8(mm.val[1]), vreinterpretq_u16_u8(pal.val[1]), p1);
+            if (half) {
+                vst1q_u16(&renderPosition[i], p0);
+                vst1q_u16(&renderPosition[i + 8], p1);
+            } else {
+                uint16x8x2_t q0 = vzipq_u16(p0, p0);
+                uint16x8x2_t q1 = vzipq_u16(p1, p1);
+                vst1q_u16(&renderPosition[i * 2], q0.val[0]);
+                vst1q_u16(&renderPosition[i * 2 + 8], q0.val[1]);
+                vst1q_u16(&renderPosition[i * 2 + 16], q1.val[0]);
+                vst1q_u16(&renderPosition[i * 2 + 24], q1.val[1]);
+            }
+        }
+#endif
+    }
+#endif
+
     inline void renderPixel2(unsigned short* renderPosition, int paletteNumber)
     {
         if (0 == (this->ctx.reg[8] & 0b00100000) && !paletteNumber) return;
-        *renderPosition = this->palette[paletteNumber];
-        *(renderPosition + 1) = this->palette[paletteNumber];
+        this->storePixel2(renderPosition, this->palette[paletteNumber]);
     }
 
     inline void renderPixelS1(unsigned short* renderPosition, int paletteNumber)
@@ -1154,17 +2025,16 @@ class V9958
     inline void renderPixel2S1(unsigned short* renderPosition, int paletteNumber)
     {
         if (!paletteNumber) return;
-        *renderPosition = this->palette[paletteNumber];
-        *(renderPosition + 1) = this->palette[paletteNumber];
+        this->storePixel2(renderPosition, this->palette[paletteNumber]);
     }
 
     inline void renderPixel2S2(unsigned short* renderPosition, int paletteNumber)
     {
         if (!paletteNumber || !this->isSpriteDisplay()) return;
-        *renderPosition = this->palette[paletteNumber];
-        *(renderPosition + 1) = this->palette[paletteNumber];
+        this->storePixel2(renderPosition, this->palette[paletteNumber]);
     }
 
+    template <bool HALF>
     inline void renderScanlineModeG1(int lineNumber, unsigned short* renderPosition)
     {
         int pn = this->getNameTableAddress();
@@ -1180,45 +2050,46 @@ class V9958
             unsigned char cc[2];
             cc[1] = (c & 0xF0) >> 4;
             cc[0] = c & 0x0F;
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-            this->renderPixel1(&renderPosition[cur], cc[(ptn & 0b10000000) >> 7]);
-            cur++;
-            this->renderPixel1(&renderPosition[cur], cc[(ptn & 0b01000000) >> 6]);
-            cur++;
-            this->renderPixel1(&renderPosition[cur], cc[(ptn & 0b00100000) >> 5]);
-            cur++;
-            this->renderPixel1(&renderPosition[cur], cc[(ptn & 0b00010000) >> 4]);
-            cur++;
-            this->renderPixel1(&renderPosition[cur], cc[(ptn & 0b00001000) >> 3]);
-            cur++;
-            this->renderPixel1(&renderPosition[cur], cc[(ptn & 0b00000100) >> 2]);
-            cur++;
-            this->renderPixel1(&renderPosition[cur], cc[(ptn & 0b00000010) >> 1]);
-            cur++;
-            this->renderPixel1(&renderPosition[cur], cc[ptn & 0b00000001]);
-            cur++;
-#else
-            this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b10000000) >> 7]);
-            cur += 2;
-            this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b01000000) >> 6]);
-            cur += 2;
-            this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00100000) >> 5]);
-            cur += 2;
-            this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00010000) >> 4]);
-            cur += 2;
-            this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00001000) >> 3]);
-            cur += 2;
-            this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00000100) >> 2]);
-            cur += 2;
-            this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00000010) >> 1]);
-            cur += 2;
-            this->renderPixel2(&renderPosition[cur], cc[ptn & 0b00000001]);
-            cur += 2;
-#endif
+            if (HALF) {
+                this->renderPixel1(&renderPosition[cur], cc[(ptn & 0b10000000) >> 7]);
+                cur++;
+                this->renderPixel1(&renderPosition[cur], cc[(ptn & 0b01000000) >> 6]);
+                cur++;
+                this->renderPixel1(&renderPosition[cur], cc[(ptn & 0b00100000) >> 5]);
+                cur++;
+                this->renderPixel1(&renderPosition[cur], cc[(ptn & 0b00010000) >> 4]);
+                cur++;
+                this->renderPixel1(&renderPosition[cur], cc[(ptn & 0b00001000) >> 3]);
+                cur++;
+                this->renderPixel1(&renderPosition[cur], cc[(ptn & 0b00000100) >> 2]);
+                cur++;
+                this->renderPixel1(&renderPosition[cur], cc[(ptn & 0b00000010) >> 1]);
+                cur++;
+                this->renderPixel1(&renderPosition[cur], cc[ptn & 0b00000001]);
+                cur++;
+            } else {
+                this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b10000000) >> 7]);
+                cur += 2;
+                this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b01000000) >> 6]);
+                cur += 2;
+                this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00100000) >> 5]);
+                cur += 2;
+                this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00010000) >> 4]);
+                cur += 2;
+                this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00001000) >> 3]);
+                cur += 2;
+                this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00000100) >> 2]);
+                cur += 2;
+                this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00000010) >> 1]);
+                cur += 2;
+                this->renderPixel2(&renderPosition[cur], cc[ptn & 0b00000001]);
+                cur += 2;
+            }
         }
-        renderSpritesMode1(lineNumber, renderPosition);
+        this->renderSpritesMode1<HALF>(lineNumber, renderPosition);
     }
 
+    template <bool HALF>
     inline void renderScanlineModeG23(int lineNumber, bool isSpriteMode2, unsigned short* renderPosition)
     {
         int sp2 = this->getSP2();
@@ -1256,64 +2127,61 @@ class V9958
             cc[1] = cc[1] ? cc[1] : bd;
             cc[0] = c & 0x0F;
             cc[0] = cc[0] ? cc[0] : bd;
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-            this->renderPixel1(&renderPosition[cur++], cc[(ptn & 0b10000000) >> 7]);
-            if (256 <= cur) break;
-            this->renderPixel1(&renderPosition[cur++], cc[(ptn & 0b01000000) >> 6]);
-            if (256 <= cur) break;
-            this->renderPixel1(&renderPosition[cur++], cc[(ptn & 0b00100000) >> 5]);
-            if (256 <= cur) break;
-            this->renderPixel1(&renderPosition[cur++], cc[(ptn & 0b00010000) >> 4]);
-            if (256 <= cur) break;
-            this->renderPixel1(&renderPosition[cur++], cc[(ptn & 0b00001000) >> 3]);
-            if (256 <= cur) break;
-            this->renderPixel1(&renderPosition[cur++], cc[(ptn & 0b00000100) >> 2]);
-            if (256 <= cur) break;
-            this->renderPixel1(&renderPosition[cur++], cc[(ptn & 0b00000010) >> 1]);
-            if (256 <= cur) break;
-            this->renderPixel1(&renderPosition[cur++], cc[ptn & 0b00000001]);
-            if (256 <= cur) break;
-#else
-            this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b10000000) >> 7]);
-            cur += 2;
-            if (512 <= cur) break;
-            this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b01000000) >> 6]);
-            cur += 2;
-            if (512 <= cur) break;
-            this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00100000) >> 5]);
-            cur += 2;
-            if (512 <= cur) break;
-            this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00010000) >> 4]);
-            cur += 2;
-            if (512 <= cur) break;
-            this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00001000) >> 3]);
-            cur += 2;
-            if (512 <= cur) break;
-            this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00000100) >> 2]);
-            cur += 2;
-            if (512 <= cur) break;
-            this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00000010) >> 1]);
-            cur += 2;
-            if (512 <= cur) break;
-            this->renderPixel2(&renderPosition[cur], cc[ptn & 0b00000001]);
-            cur += 2;
-            if (512 <= cur) break;
-#endif
+            if (HALF) {
+                this->renderPixel1(&renderPosition[cur++], cc[(ptn & 0b10000000) >> 7]);
+                if (256 <= cur) break;
+                this->renderPixel1(&renderPosition[cur++], cc[(ptn & 0b01000000) >> 6]);
+                if (256 <= cur) break;
+                this->renderPixel1(&renderPosition[cur++], cc[(ptn & 0b00100000) >> 5]);
+                if (256 <= cur) break;
+                this->renderPixel1(&renderPosition[cur++], cc[(ptn & 0b00010000) >> 4]);
+                if (256 <= cur) break;
+                this->renderPixel1(&renderPosition[cur++], cc[(ptn & 0b00001000) >> 3]);
+                if (256 <= cur) break;
+                this->renderPixel1(&renderPosition[cur++], cc[(ptn & 0b00000100) >> 2]);
+                if (256 <= cur) break;
+                this->renderPixel1(&renderPosition[cur++], cc[(ptn & 0b00000010) >> 1]);
+                if (256 <= cur) break;
+                this->renderPixel1(&renderPosition[cur++], cc[ptn & 0b00000001]);
+                if (256 <= cur) break;
+            } else {
+                this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b10000000) >> 7]);
+                cur += 2;
+                if (512 <= cur) break;
+                this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b01000000) >> 6]);
+                cur += 2;
+                if (512 <= cur) break;
+                this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00100000) >> 5]);
+                cur += 2;
+                if (512 <= cur) break;
+                this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00010000) >> 4]);
+                cur += 2;
+                if (512 <= cur) break;
+                this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00001000) >> 3]);
+                cur += 2;
+                if (512 <= cur) break;
+                this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00000100) >> 2]);
+                cur += 2;
+                if (512 <= cur) break;
+                this->renderPixel2(&renderPosition[cur], cc[(ptn & 0b00000010) >> 1]);
+                cur += 2;
+                if (512 <= cur) break;
+                this->renderPixel2(&renderPosition[cur], cc[ptn & 0b00000001]);
+                cur += 2;
+                if (512 <= cur) break;
+            }
         }
         if (isSpriteMode2) {
-            renderSpritesMode2(lineNumber, renderPosition);
+            this->renderSpritesMode2<HALF>(lineNumber, renderPosition);
         } else {
-            renderSpritesMode1(lineNumber, renderPosition);
+            this->renderSpritesMode1<HALF>(lineNumber, renderPosition);
         }
     }
 
+    template <bool HALF>
     inline void renderScanlineModeG4(int lineNumber, unsigned short* renderPosition)
     {
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-        int curD = (this->ctx.reg[27] & 0b00000111) / 2;
-#else
-        int curD = this->ctx.reg[27] & 0b00000111;
-#endif
+        int curD = HALF ? (this->ctx.reg[27] & 0b00000111) / 2 : this->ctx.reg[27] & 0b00000111;
         int addr = ((lineNumber + this->ctx.reg[23]) & 0xFF) * 128 + this->getNameTableAddress();
         int addr2 = 0;
         int sp2 = this->getSP2();
@@ -1335,36 +2203,40 @@ class V9958
             addr &= 0x17FFF;
             addr |= (this->ctx.counter & 1) << 15;
         }
-        for (int i = 0; i < 128; i++) {
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-            this->renderPixel1(&renderPosition[curD++], (this->ctx.ram[addr + x] & 0xF0) >> 4);
-            if (256 <= curD) break;
-            this->renderPixel1(&renderPosition[curD++], this->ctx.ram[addr + x] & 0x0F);
-            if (256 <= curD) break;
+#ifdef V9958_SIMD
+        this->updateBitmapLUT(false);
+        auto line = this->gatherBitmapLine(addr, x, 128, [sp2, addr2](int a) { return sp2 ? addr2 : a; });
+        int count = HALF ? 256 - curD : (512 - curD + 1) & ~1;
+        this->lookupBitmapPixels(&renderPosition[curD], this->expandBitmapLine(line, 4, HALF), count, 0 == (this->ctx.reg[8] & 0b00100000));
 #else
-            this->renderPixel2(&renderPosition[curD], (this->ctx.ram[addr + x] & 0xF0) >> 4);
-            curD += 2;
-            if (512 <= curD) break;
-            this->renderPixel2(&renderPosition[curD], this->ctx.ram[addr + x] & 0x0F);
-            curD += 2;
-            if (512 <= curD) break;
-#endif
+        for (int i = 0; i < 128; i++) {
+            if (HALF) {
+                this->renderPixel1(&renderPosition[curD++], (this->ctx.ram[(addr + x) & 0x1FFFF] & 0xF0) >> 4);
+                if (256 <= curD) break;
+                this->renderPixel1(&renderPosition[curD++], this->ctx.ram[(addr + x) & 0x1FFFF] & 0x0F);
+                if (256 <= curD) break;
+            } else {
+                this->renderPixel2(&renderPosition[curD], (this->ctx.ram[(addr + x) & 0x1FFFF] & 0xF0) >> 4);
+                curD += 2;
+                if (512 <= curD) break;
+                this->renderPixel2(&renderPosition[curD], this->ctx.ram[(addr + x) & 0x1FFFF] & 0x0F);
+                curD += 2;
+                if (512 <= curD) break;
+            }
             x++;
             x &= 0x7F;
             if (0 == x && sp2) {
                 addr = addr2;
             }
         }
-        renderSpritesMode2(lineNumber, renderPosition);
+#endif
+        this->renderSpritesMode2<HALF>(lineNumber, renderPosition);
     }
 
+    template <bool HALF>
     inline void renderScanlineModeG5(int lineNumber, unsigned short* renderPosition)
     {
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-        int curD = this->ctx.reg[27] & 0b00000111;
-#else
-        int curD = (this->ctx.reg[27] & 0b00000111) << 1;
-#endif
+        int curD = HALF ? this->ctx.reg[27] & 0b00000111 : (this->ctx.reg[27] & 0b00000111) << 1;
         int addr = ((lineNumber + this->ctx.reg[23]) & 0xFF) * 128 + this->getNameTableAddress();
         int sp2 = this->getSP2();
         int x = this->ctx.reg[26];
@@ -1379,39 +2251,42 @@ class V9958
             x &= 0b00011111;
         }
         x <<= 2;
+#ifdef V9958_SIMD
+        this->updateBitmapLUT(false);
+        auto line = this->gatherBitmapLine(addr & 0x1FFFF, x, 128, [sp2](int a) { return sp2 ? (a ^ 0x8000) & 0x1FFFF : a; });
+        this->lookupBitmapPixels(&renderPosition[curD], this->expandBitmapLine(line, 5, HALF), (HALF ? 256 : 512) - curD, 0 == (this->ctx.reg[8] & 0b00100000));
+#else
         for (int i = 0; i < 128; i++) {
             addr &= 0x1FFFF;
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-            this->renderPixel1(&renderPosition[curD++], (this->ctx.ram[addr + x] & 0xC0) >> 6);
-            if (256 <= curD) break;
-            this->renderPixel1(&renderPosition[curD++], (this->ctx.ram[addr + x] & 0x0C) >> 2);
-            if (256 <= curD) break;
-#else
-            this->renderPixel1(&renderPosition[curD++], (this->ctx.ram[addr + x] & 0xC0) >> 6);
-            if (512 <= curD) break;
-            this->renderPixel1(&renderPosition[curD++], (this->ctx.ram[addr + x] & 0x30) >> 4);
-            if (512 <= curD) break;
-            this->renderPixel1(&renderPosition[curD++], (this->ctx.ram[addr + x] & 0x0C) >> 2);
-            if (512 <= curD) break;
-            this->renderPixel1(&renderPosition[curD++], this->ctx.ram[addr + x] & 0x03);
-            if (512 <= curD) break;
-#endif
+            if (HALF) {
+                this->renderPixel1(&renderPosition[curD++], (this->ctx.ram[(addr + x) & 0x1FFFF] & 0xC0) >> 6);
+                if (256 <= curD) break;
+                this->renderPixel1(&renderPosition[curD++], (this->ctx.ram[(addr + x) & 0x1FFFF] & 0x0C) >> 2);
+                if (256 <= curD) break;
+            } else {
+                this->renderPixel1(&renderPosition[curD++], (this->ctx.ram[(addr + x) & 0x1FFFF] & 0xC0) >> 6);
+                if (512 <= curD) break;
+                this->renderPixel1(&renderPosition[curD++], (this->ctx.ram[(addr + x) & 0x1FFFF] & 0x30) >> 4);
+                if (512 <= curD) break;
+                this->renderPixel1(&renderPosition[curD++], (this->ctx.ram[(addr + x) & 0x1FFFF] & 0x0C) >> 2);
+                if (512 <= curD) break;
+                this->renderPixel1(&renderPosition[curD++], this->ctx.ram[(addr + x) & 0x1FFFF] & 0x03);
+                if (512 <= curD) break;
+            }
             x++;
             x &= 0x7F;
             if (0 == x && sp2) {
                 addr ^= 0x8000;
             }
         }
-        renderSpritesMode2(lineNumber, renderPosition);
+#endif
+        this->renderSpritesMode2<HALF>(lineNumber, renderPosition);
     }
 
+    template <bool HALF>
     inline void renderScanlineModeG6(int lineNumber, unsigned short* renderPosition)
     {
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-        int curD = this->ctx.reg[27] & 0b00000111;
-#else
-        int curD = (this->ctx.reg[27] & 0b00000111) << 1;
-#endif
+        int curD = HALF ? this->ctx.reg[27] & 0b00000111 : (this->ctx.reg[27] & 0b00000111) << 1;
         int addr = ((lineNumber + this->ctx.reg[23]) & 0xFF) * 256 + this->getNameTableAddress();
         int sp2 = this->getSP2();
         int x = this->ctx.reg[26];
@@ -1430,23 +2305,29 @@ class V9958
             x &= 0b00011111;
         }
         x <<= 3;
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-        for (int i = 0; i < 256 && curD < 256; i++) {
-            this->renderPixel1(&renderPosition[curD++], (this->ctx.ram[addr + x] & 0xF0) >> 4);
-            x++;
-            x &= 0xFF;
-            addr ^= 0 == x && sp2 ? 0x10000 : 0;
-        }
+#ifdef V9958_SIMD
+        this->updateBitmapLUT(false);
+        auto line = this->gatherBitmapLine(addr, x, 256, [sp2](int a) { return sp2 ? a ^ 0x10000 : a; });
+        this->lookupBitmapPixels(&renderPosition[curD], this->expandBitmapLine(line, 6, HALF), (HALF ? 256 : 512) - curD, 0 == (this->ctx.reg[8] & 0b00100000));
 #else
-        for (int i = 0; i < 256 && curD < 512; i++) {
-            this->renderPixel1(&renderPosition[curD++], (this->ctx.ram[addr + x] & 0xF0) >> 4);
-            this->renderPixel1(&renderPosition[curD++], this->ctx.ram[addr + x] & 0x0F);
-            x++;
-            x &= 0xFF;
-            addr ^= 0 == x && sp2 ? 0x10000 : 0;
+        if (HALF) {
+            for (int i = 0; i < 256 && curD < 256; i++) {
+                this->renderPixel1(&renderPosition[curD++], (this->ctx.ram[(addr + x) & 0x1FFFF] & 0xF0) >> 4);
+                x++;
+                x &= 0xFF;
+                addr ^= 0 == x && sp2 ? 0x10000 : 0;
+            }
+        } else {
+            for (int i = 0; i < 256 && curD < 512; i++) {
+                this->renderPixel1(&renderPosition[curD++], (this->ctx.ram[(addr + x) & 0x1FFFF] & 0xF0) >> 4);
+                this->renderPixel1(&renderPosition[curD++], this->ctx.ram[(addr + x) & 0x1FFFF] & 0x0F);
+                x++;
+                x &= 0xFF;
+                addr ^= 0 == x && sp2 ? 0x10000 : 0;
+            }
         }
 #endif
-        renderSpritesMode2(lineNumber, renderPosition);
+        this->renderSpritesMode2<HALF>(lineNumber, renderPosition);
     }
 
     inline unsigned short convertColor_8bit_to_16bit(unsigned char c)
@@ -1471,52 +2352,63 @@ class V9958
         }
     }
 
+    template <bool HALF>
     inline void renderScanlineModeG7(int lineNumber, unsigned short* renderPosition)
     {
-        int curD = 0;
         int curP = ((lineNumber + this->ctx.reg[23]) & 0xFF) * 256;
         curP += this->getNameTableAddress();
         if (this->isYJK()) {
+#ifdef V9958_SIMD
+            this->updateBitmapLUT(false);
+            this->renderYjkPixels(renderPosition, &this->ctx.ram[curP], HALF);
+#else
+            bool yae = this->isYAE();
+            int curD = 0;
             for (int i = 0; i < 256; i += 4) {
                 unsigned char y[4];
                 y[0] = this->ctx.ram[curP++];
                 y[1] = this->ctx.ram[curP++];
                 y[2] = this->ctx.ram[curP++];
                 y[3] = this->ctx.ram[curP++];
-                unsigned char k = (y[1] & 0b00000111) << 3;
+                int k = (y[1] & 0b00000111) << 3;
                 k |= y[0] & 0b00000111;
-                unsigned char j = (y[3] & 0b00000111) << 3;
+                k = (k & 0x1F) - (k & 0x20);
+                int j = (y[3] & 0b00000111) << 3;
                 j |= y[2] & 0b00000111;
+                j = (j & 0x1F) - (j & 0x20);
                 for (int n = 0; n < 4; n++) {
-                    y[n] &= 0b11111000;
                     y[n] >>= 3;
-                    if (this->isYAE() && (y[n] & 1)) {
-                        renderPosition[curD] = this->palette[(y[n] >> 1) & 0x0F];
+                    unsigned short c = yae && (y[n] & 1) ? this->palette[y[n] >> 1] : this->convertColorYJK(y[n], j, k);
+                    if (HALF) {
+                        renderPosition[curD++] = c;
                     } else {
-                        renderPosition[curD] = this->yjkColor[y[n]][j][k];
+                        this->storePixel2(&renderPosition[curD], c);
+                        curD += 2;
                     }
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-                    curD++;
-#else
-                    renderPosition[curD + 1] = renderPosition[curD];
-                    curD += 2;
-#endif
                 }
             }
+#endif
         } else {
-            for (int i = 0; i < 256; i++) {
-                renderPosition[curD] = convertColor_8bit_to_16bit(this->ctx.ram[curP++]);
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-                curD++;
+#ifdef V9958_SIMD
+            this->updateBitmapLUT(true);
+            auto line = &this->ctx.ram[curP];
+            this->lookupBitmapPixels(renderPosition, HALF ? line : this->expandBitmapLine(line, 7, false), HALF ? 256 : 512, false);
 #else
-                renderPosition[curD + 1] = renderPosition[curD];
-                curD += 2;
-#endif
+            int curD = 0;
+            for (int i = 0; i < 256; i++) {
+                if (HALF) {
+                    renderPosition[curD++] = convertColor_8bit_to_16bit(this->ctx.ram[curP++]);
+                } else {
+                    this->storePixel2(&renderPosition[curD], convertColor_8bit_to_16bit(this->ctx.ram[curP++]));
+                    curD += 2;
+                }
             }
+#endif
         }
-        renderSpritesMode2(lineNumber, renderPosition);
+        this->renderSpritesMode2<HALF>(lineNumber, renderPosition);
     }
 
+    template <bool HALF>
     inline void renderScanlineModeMC(int lineNumber, unsigned short* renderPosition)
     {
         int pn = this->getNameTableAddress();
@@ -1533,9 +2425,10 @@ class V9958
                 cur += 2;
             }
         }
-        renderSpritesMode1(lineNumber, renderPosition);
+        this->renderSpritesMode1<HALF>(lineNumber, renderPosition);
     }
 
+    template <bool HALF>
     inline void renderScanlineModeT1(int lineNumber, unsigned short* renderPosition)
     {
         int pn = this->getNameTableAddress();
@@ -1546,30 +2439,31 @@ class V9958
         int cur = 0;
         for (int i = 0; i < 40; i++) {
             unsigned char ptn = this->ctx.ram[pg + nam[i] * 8 + lineNumberMod8];
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-            this->renderPixel1(&renderPosition[cur++], ptn & 0b10000000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-            this->renderPixel1(&renderPosition[cur++], ptn & 0b01000000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-            this->renderPixel1(&renderPosition[cur++], ptn & 0b00100000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-            this->renderPixel1(&renderPosition[cur++], ptn & 0b00010000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-            this->renderPixel1(&renderPosition[cur++], ptn & 0b00001000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-            this->renderPixel1(&renderPosition[cur++], ptn & 0b00000100 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-#else
-            this->renderPixel2(&renderPosition[cur], ptn & 0b10000000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-            cur += 2;
-            this->renderPixel2(&renderPosition[cur], ptn & 0b01000000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-            cur += 2;
-            this->renderPixel2(&renderPosition[cur], ptn & 0b00100000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-            cur += 2;
-            this->renderPixel2(&renderPosition[cur], ptn & 0b00010000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-            cur += 2;
-            this->renderPixel2(&renderPosition[cur], ptn & 0b00001000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-            cur += 2;
-            this->renderPixel2(&renderPosition[cur], ptn & 0b00000100 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-            cur += 2;
-#endif
+            if (HALF) {
+                this->renderPixel1(&renderPosition[cur++], ptn & 0b10000000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+                this->renderPixel1(&renderPosition[cur++], ptn & 0b01000000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+                this->renderPixel1(&renderPosition[cur++], ptn & 0b00100000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+                this->renderPixel1(&renderPosition[cur++], ptn & 0b00010000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+                this->renderPixel1(&renderPosition[cur++], ptn & 0b00001000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+                this->renderPixel1(&renderPosition[cur++], ptn & 0b00000100 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+            } else {
+                this->renderPixel2(&renderPosition[cur], ptn & 0b10000000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+                cur += 2;
+                this->renderPixel2(&renderPosition[cur], ptn & 0b01000000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+                cur += 2;
+                this->renderPixel2(&renderPosition[cur], ptn & 0b00100000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+                cur += 2;
+                this->renderPixel2(&renderPosition[cur], ptn & 0b00010000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+                cur += 2;
+                this->renderPixel2(&renderPosition[cur], ptn & 0b00001000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+                cur += 2;
+                this->renderPixel2(&renderPosition[cur], ptn & 0b00000100 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+                cur += 2;
+            }
         }
     }
 
+    template <bool HALF>
     inline void renderScanlineModeT2(int lineNumber, unsigned short* renderPosition)
     {
         int pn = this->getNameTableAddress();
@@ -1580,21 +2474,22 @@ class V9958
         int cur = 0;
         for (int i = 0; i < 80; i++) {
             unsigned char ptn = this->ctx.ram[pg + nam[i] * 8 + lineNumberMod8];
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-            this->renderPixel1(&renderPosition[cur++], ptn & 0b10000000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-            this->renderPixel1(&renderPosition[cur++], ptn & 0b00100000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-            this->renderPixel1(&renderPosition[cur++], ptn & 0b00001000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-#else
-            this->renderPixel1(&renderPosition[cur++], ptn & 0b10000000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-            this->renderPixel1(&renderPosition[cur++], ptn & 0b01000000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-            this->renderPixel1(&renderPosition[cur++], ptn & 0b00100000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-            this->renderPixel1(&renderPosition[cur++], ptn & 0b00010000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-            this->renderPixel1(&renderPosition[cur++], ptn & 0b00001000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-            this->renderPixel1(&renderPosition[cur++], ptn & 0b00000100 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
-#endif
+            if (HALF) {
+                this->renderPixel1(&renderPosition[cur++], ptn & 0b10000000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+                this->renderPixel1(&renderPosition[cur++], ptn & 0b00100000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+                this->renderPixel1(&renderPosition[cur++], ptn & 0b00001000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+            } else {
+                this->renderPixel1(&renderPosition[cur++], ptn & 0b10000000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+                this->renderPixel1(&renderPosition[cur++], ptn & 0b01000000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+                this->renderPixel1(&renderPosition[cur++], ptn & 0b00100000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+                this->renderPixel1(&renderPosition[cur++], ptn & 0b00010000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+                this->renderPixel1(&renderPosition[cur++], ptn & 0b00001000 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+                this->renderPixel1(&renderPosition[cur++], ptn & 0b00000100 ? (this->ctx.reg[7] & 0xF0) >> 4 : this->ctx.reg[7] & 0x0F);
+            }
         }
     }
 
+    template <bool HALF>
     inline void renderSpritesMode1(int lineNumber, unsigned short* renderPosition)
     {
         static const unsigned char bit[8] = {
@@ -1654,11 +2549,13 @@ class V9958
                     }
                     if (0 == dlog[x]) {
                         if (this->ctx.ram[cur] & bit[j / mag]) {
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-                            this->renderPixelS1(&renderPosition[x], col);
-#else
-                            this->renderPixel2S1(&renderPosition[x << 1], col);
-#endif
+                            if (renderPosition) {
+                                if (HALF) {
+                                    this->renderPixelS1(&renderPosition[x], col);
+                                } else {
+                                    this->renderPixel2S1(&renderPosition[x << 1], col);
+                                }
+                            }
                             dlog[x] = col;
                             wlog[x] = 1;
                         }
@@ -1673,11 +2570,13 @@ class V9958
                         }
                         if (0 == dlog[x]) {
                             if (this->ctx.ram[cur] & bit[j / mag]) {
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-                                this->renderPixel2S1(&renderPosition[x], col);
-#else
-                                this->renderPixel2S1(&renderPosition[x << 1], col);
-#endif
+                                if (renderPosition) {
+                                    if (HALF) {
+                                        this->renderPixel2S1(&renderPosition[x], col);
+                                    } else {
+                                        this->renderPixel2S1(&renderPosition[x << 1], col);
+                                    }
+                                }
                                 dlog[x] = col;
                                 wlog[x] = 1;
                             }
@@ -1688,32 +2587,40 @@ class V9958
         }
     }
 
-    inline void renderSpritesMode2(int lineNumber, unsigned short* renderPosition)
+    // pixels of a pattern byte (bit n: pixel n, magnified if mag is 2)
+    static inline unsigned int expandSpritePattern(unsigned char ptn, int mag)
     {
-        static const unsigned char bit[8] = {
-            0b10000000,
-            0b01000000,
-            0b00100000,
-            0b00010000,
-            0b00001000,
-            0b00000100,
-            0b00000010,
-            0b00000001};
+        unsigned int result = 0;
+        for (int j = 0; j < 8; j++) {
+            if (ptn & (0x80 >> j)) {
+                result |= (2 == mag ? 3U : 1U) << (j * mag);
+            }
+        }
+        return result;
+    }
+
+    // visible sprites (mode 2) on the scanline (rebuilt only after the sprite tables or the registers are changed)
+    inline SpriteCache::Line* getSpriteLine(int lineNumber)
+    {
+        auto line = &this->spriteCache.line[lineNumber & 0xFF];
+        if (line->version == this->spriteVersion) {
+            return line;
+        }
+        if (this->spriteCache.version == this->spriteVersion && 1024 - 32 < this->spriteCache.used) {
+            this->spriteVersion++; // no space: discard the entries of all lines
+        }
+        if (this->spriteCache.version != this->spriteVersion) {
+            this->spriteCache.version = this->spriteVersion;
+            this->spriteCache.used = 0;
+        }
+        line->version = this->spriteVersion;
+        line->start = this->spriteCache.used;
+        line->count = 0;
         int si = this->isSprite16px() ? 16 : 8;
         int mag = this->isSprite2x() ? 2 : 1;
         int sa = this->getSpriteAttributeTableM2();
         int ct = this->getSpriteColorTable();
         int sg = this->getSpriteGeneratorTable();
-        int sn = 0;
-        int tsn = 0;
-        unsigned char paletteMask = this->getScreenMode() == 0b00100 ? 0x03 : 0x0F;
-        unsigned char dlog[256];
-        unsigned char wlog[256];
-        unsigned char skip[256];
-        memset(dlog, 0, sizeof(dlog));
-        memset(wlog, 0, sizeof(wlog));
-        memset(skip, 0, sizeof(skip));
-        bool limitOver = false;
         for (int i = 0; i < 32; i++, ct += 16) {
             int cur = sa + i * 4;
             unsigned char y = this->ctx.ram[cur++];
@@ -1722,88 +2629,138 @@ class V9958
             unsigned char ptn = this->ctx.ram[cur++];
             y += 1 - this->ctx.reg[23];
             if (y <= lineNumber && lineNumber < y + si * mag) {
-                sn++;
                 int pixelLine = lineNumber - y;
                 unsigned char col = this->ctx.ram[ct + pixelLine / mag];
-                bool ic = col & 0x20;
-                bool cc = col & 0x40;
                 if (col & 0x80) x -= 32;
-                col &= paletteMask;
-                if (!col) tsn++;
-                if (9 == sn) {
-                    this->set5S(true, i);
-                    if (!this->renderLimitOverSprites) {
-                        break;
-                    } else {
-                        if (8 <= tsn) break;
-                        limitOver = true;
-                    }
-                } else if (sn < 9) {
-                    this->set5S(false, i);
-                }
+                auto entry = &this->spriteCache.entry[this->spriteCache.used++];
                 if (16 == si) {
                     cur = sg + (ptn & 252) * 8 + pixelLine % (8 * mag) / mag + (pixelLine < 8 * mag ? 0 : 8);
+                    entry->pattern = expandSpritePattern(this->ctx.ram[cur], mag);
+                    entry->pattern |= expandSpritePattern(this->ctx.ram[cur + 16], mag) << (8 * mag);
                 } else {
                     cur = sg + ptn * 8 + lineNumber % (8 * mag) / mag;
+                    entry->pattern = expandSpritePattern(this->ctx.ram[cur], mag);
                 }
-                for (int j = 0; x < 256 && j < 8 * mag; j++, x++) {
-                    if (x < 0) continue;
-                    if (dlog[x] && !limitOver && !ic) {
-                        this->setCollision(x, lineNumber);
+                entry->x = (short)x;
+                entry->sn = (unsigned char)i;
+                entry->col = col;
+                line->count++;
+            }
+        }
+        return line;
+    }
+
+    // 32 bits of a 256 bits mask from x (0 <= x < 256)
+    static inline unsigned int getLineMask(const unsigned long long* mask, int x)
+    {
+        int o = x & 63;
+        unsigned long long result = mask[x >> 6] >> o;
+        if (o) result |= mask[(x >> 6) + 1] << (64 - o);
+        return (unsigned int)result;
+    }
+
+    static inline void setLineMask(unsigned long long* mask, int x, unsigned int bits)
+    {
+        int o = x & 63;
+        mask[x >> 6] |= (unsigned long long)bits << o;
+        if (32 < o) mask[(x >> 6) + 1] |= (unsigned long long)bits >> (64 - o);
+    }
+
+    template <bool HALF>
+    inline void renderSpritesMode2(int lineNumber, unsigned short* renderPosition)
+    {
+        auto line = this->getSpriteLine(lineNumber);
+        int width = (this->isSprite16px() ? 16 : 8) * (this->isSprite2x() ? 2 : 1);
+        unsigned int span = 32 == width ? 0xFFFFFFFF : (1U << width) - 1;
+        int sn = 0;
+        int tsn = 0;
+        unsigned char paletteMask = this->getScreenMode() == 0b00100 ? 0x03 : 0x0F;
+        if (!this->isSpriteDisplay()) renderPosition = nullptr;
+        unsigned char dlog[256];         // color of the pixel (valid if dmask is set)
+        unsigned long long dmask[5] = {}; // pixels that have a non-transparent color without CC
+        unsigned long long wmask[5] = {}; // pixels that have been written
+        unsigned long long smask[5] = {}; // pixels that CC sprites must skip
+        bool limitOver = false;
+        for (int n = 0; n < line->count; n++) {
+            auto entry = &this->spriteCache.entry[line->start + n];
+            sn++;
+            unsigned char col = entry->col;
+            bool ic = col & 0x20;
+            bool cc = col & 0x40;
+            col &= paletteMask;
+            if (!col) tsn++;
+            if (9 == sn) {
+                this->set5S(true, entry->sn);
+                if (!this->renderLimitOverSprites) {
+                    break;
+                } else {
+                    if (8 <= tsn) break;
+                    limitOver = true;
+                }
+            } else if (sn < 9) {
+                this->set5S(false, entry->sn);
+            }
+            // clip the sprite to 0 <= x < 256
+            int x = entry->x;
+            unsigned int ptn = entry->pattern;
+            unsigned int area = span;
+            if (x <= -32) {
+                continue;
+            } else if (x < 0) {
+                ptn >>= -x;
+                area >>= -x;
+                x = 0;
+            }
+            if (224 < x) {
+                ptn &= (1U << (256 - x)) - 1;
+                area &= (1U << (256 - x)) - 1;
+            }
+            if (!area) continue;
+            if (!limitOver && !ic) {
+                unsigned int hit = area & getLineMask(dmask, x);
+                if (hit) {
+                    int last = 31;
+                    while (!(hit & 0x80000000)) {
+                        hit <<= 1;
+                        last--;
                     }
-                    if (0 == wlog[x] || cc) {
-                        if (this->ctx.ram[cur] & bit[j / mag]) {
-                            if (cc) {
-                                if (!skip[x]) {
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-                                    this->renderPixelS2(&renderPosition[x], dlog[x] | col);
-#else
-                                    this->renderPixel2S2(&renderPosition[x << 1], dlog[x] | col);
-#endif
-                                }
+                    this->setCollision(x + last, lineNumber);
+                }
+            }
+            unsigned int draw;
+            if (cc) {
+                draw = ptn & ~getLineMask(smask, x);
+                if (renderPosition) {
+                    unsigned int dm = getLineMask(dmask, x);
+                    for (int px = x; draw; draw >>= 1, dm >>= 1, px++) {
+                        if (draw & 1) {
+                            int c = (dm & 1 ? dlog[px] : 0) | col;
+                            if (HALF) {
+                                this->renderPixelS2(&renderPosition[px], c);
                             } else {
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-                                this->renderPixelS2(&renderPosition[x], col);
-#else
-                                this->renderPixel2S2(&renderPosition[x << 1], col);
-#endif
-                                dlog[x] = col;
+                                this->renderPixel2S2(&renderPosition[px << 1], c);
                             }
-                            wlog[x] = 1;
                         }
-                    } else {
-                        skip[x] = 1;
                     }
                 }
-                if (16 == si) {
-                    cur += 16;
-                    for (int j = 0; x < 256 && j < 8 * mag; j++, x++) {
-                        if (x < 0) continue;
-                        if (dlog[x] && !limitOver && !ic) {
-                            this->setCollision(x, lineNumber);
-                        }
-                        if (0 == wlog[x] || cc) {
-                            if (this->ctx.ram[cur] & bit[j / mag]) {
-                                if (cc) {
-                                    if (!skip[x]) {
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-                                        this->renderPixelS2(&renderPosition[x], dlog[x] | col);
-#else
-                                        this->renderPixel2S2(&renderPosition[x << 1], dlog[x] | col);
-#endif
-                                    }
+                setLineMask(wmask, x, ptn);
+            } else {
+                unsigned int written = getLineMask(wmask, x);
+                draw = ptn & ~written;
+                setLineMask(smask, x, area & written);
+                setLineMask(wmask, x, draw);
+                if (col) {
+                    setLineMask(dmask, x, draw);
+                    for (int px = x; draw; draw >>= 1, px++) {
+                        if (draw & 1) {
+                            dlog[px] = col;
+                            if (renderPosition) {
+                                if (HALF) {
+                                    this->renderPixelS2(&renderPosition[px], col);
                                 } else {
-#ifdef MSX2_DISPLAY_HALF_HORIZONTAL
-                                    this->renderPixelS2(&renderPosition[x], col);
-#else
-                                    this->renderPixel2S2(&renderPosition[x << 1], col);
-#endif
-                                    dlog[x] = col;
+                                    this->renderPixel2S2(&renderPosition[px << 1], col);
                                 }
-                                wlog[x] = 1;
                             }
-                        } else {
-                            skip[x] = 1;
                         }
                     }
                 }
@@ -2104,6 +3061,7 @@ class V9958
         }
         int addr = this->ctx.cmd.dx / dpb + this->ctx.cmd.dy * lineBytes;
         this->ctx.ram[addr] = this->ctx.reg[44];
+        this->setVramChanged(addr);
         this->commandMoveD(0);
         if (this->ctx.command) {
             this->setTR(); // set TR if keep executing
@@ -2138,6 +3096,7 @@ class V9958
         while (0 < ny) {
             this->addCommandWait(40);
             memmove(&ctx.ram[addrD], &ctx.ram[addrS], size);
+            this->setVramChanged(addrD, size);
             ny--;
             addrS += diy * lineBytes;
             addrD += diy * lineBytes;
@@ -2170,13 +3129,61 @@ class V9958
         }
         int addrS = this->ctx.cmd.sx / dpb + this->ctx.cmd.sy * lineBytes;
         int addrD = this->ctx.cmd.dx / dpb + this->ctx.cmd.dy * lineBytes;
-        unsigned char d = this->ctx.ram[addrS];
+        unsigned char d = this->ctx.ram[addrS & 0x1FFFF];
         this->addCommandWait(64);
-        this->ctx.ram[addrD] = d;
+        this->ctx.ram[addrD & 0x1FFFF] = d;
+        this->setVramChanged(addrD & 0x1FFFF);
         this->addCommandWait(24);
         this->commandMoveDS(64);
     }
 
+    inline int getCommandStepsInLine(int x, int dix)
+    {
+#ifdef V9958_DISABLE_COMMAND_SPAN
+        return 1; // execute every step with commandMoveD/commandMoveDS (reference for the span executors)
+#else
+        if (x < 0 || this->getScreenWidth() <= x) {
+            return 1; // commandMoveD/commandMoveDS end the line after the first step
+        }
+        int step = this->abs(dix);
+        int steps = (this->ctx.cmd.nx + step - 1) / step;
+        if (0 < dix) {
+            steps = this->min(steps, (this->getScreenWidth() - x + step - 1) / step);
+        } else {
+            steps = this->min(steps, x / step + 1);
+        }
+        return this->max(1, steps);
+#endif
+    }
+
+    inline void executeCommandHMMMSpan()
+    {
+        // execute the steps that do not reach the end of the line at once (each step needs 88 dots)
+        int dpb = this->getDotPerByteX();
+        int steps = 0;
+        if (dpb) {
+            steps = this->min(this->getCommandStepsInLine(this->ctx.cmd.dx, this->ctx.cmd.dix), this->getCommandStepsInLine(this->ctx.cmd.sx, this->ctx.cmd.dix)) - 1;
+            steps = this->min(steps, 1 + this->commandDots / 88);
+        }
+        if (steps < 1) {
+            this->executeCommandHMMM(false);
+            return;
+        }
+        int lineBytes = this->getScreenWidth() / dpb;
+        int addrS = this->ctx.cmd.sx / dpb + this->ctx.cmd.sy * lineBytes;
+        int addrD = this->ctx.cmd.dx / dpb + this->ctx.cmd.dy * lineBytes;
+        int inc = this->ctx.cmd.dix / dpb;
+        for (int i = 0; i < steps; i++, addrS += inc, addrD += inc) {
+            this->ctx.ram[addrD & 0x1FFFF] = this->ctx.ram[addrS & 0x1FFFF];
+            this->setVramChanged(addrD & 0x1FFFF);
+        }
+        this->ctx.cmd.sx += this->ctx.cmd.dix * steps;
+        this->ctx.cmd.dx += this->ctx.cmd.dix * steps;
+        this->ctx.cmd.nx -= this->abs(this->ctx.cmd.dix) * steps;
+        this->commandDots -= (steps - 1) * 88;
+        this->addCommandWait(88);
+    }
+
     inline void executeCommandHMMV(bool setup)
     {
         if (!this->isBitmapMode()) {
@@ -2200,10 +3207,37 @@ class V9958
         }
         int addr = this->ctx.cmd.dx / dpb + this->ctx.cmd.dy * lineBytes;
         this->ctx.ram[addr & 0x1FFFF] = this->ctx.reg[44];
+        this->setVramChanged(addr & 0x1FFFF);
         this->addCommandWait(48);
         this->commandMoveD(56);
     }
 
+    inline void executeCommandHMMVSpan()
+    {
+        // execute the steps that do not reach the end of the line at once (each step needs 48 dots)
+        int dpb = this->getDotPerByteX();
+        int steps = 0;
+        if (dpb) {
+            steps = this->getCommandStepsInLine(this->ctx.cmd.dx, this->ctx.cmd.dix) - 1;
+            steps = this->min(steps, 1 + this->commandDots / 48);
+        }
+        if (steps < 1) {
+            this->executeCommandHMMV(false);
+            return;
+        }
+        int addr = this->ctx.cmd.dx / dpb + this->ctx.cmd.dy * (this->getScreenWidth() / dpb);
+        int inc = this->ctx.cmd.dix / dpb;
+        unsigned char clr = this->ctx.reg[44];
+        for (int i = 0; i < steps; i++, addr += inc) {
+            this->ctx.ram[addr & 0x1FFFF] = clr;
+            this->setVramChanged(addr & 0x1FFFF);
+        }
+        this->ctx.cmd.dx += this->ctx.cmd.dix * steps;
+        this->ctx.cmd.nx -= this->abs(this->ctx.cmd.dix) * steps;
+        this->commandDots -= (steps - 1) * 48;
+        this->addCommandWait(48);
+    }
+
     inline unsigned char readLogicalPixel(int addr, int dpb, int sx)
     {
         unsigned char src = this->ctx.ram[addr & 0x1FFFF];
@@ -2224,6 +3258,7 @@ class V9958
     inline void renderLogicalPixel(int addr, int dpb, int dx, int clr, int lo)
     {
         if (clr || 0 == (lo & 0b1000)) {
+            this->setVramChanged(addr & 0x1FFFF);
             switch (dpb) {
                 case 1:
                     switch (lo & 0b0111) {
@@ -2391,6 +3426,33 @@ class V9958
         this->commandMoveDS(64);
     }
 
+    inline void executeCommandLMMMSpan()
+    {
+        // execute the steps that do not reach the end of the line at once (each step needs 120 dots)
+        int dpb = this->getDotPerByteX();
+        int steps = 0;
+        if (dpb) {
+            steps = this->min(this->getCommandStepsInLine(this->ctx.cmd.dx, this->ctx.cmd.dix), this->getCommandStepsInLine(this->ctx.cmd.sx, this->ctx.cmd.dix)) - 1;
+            steps = this->min(steps, 1 + this->commandDots / 120);
+        }
+        if (steps < 1) {
+            this->executeCommandLMMM(false);
+            return;
+        }
+        int lineBytes = this->getScreenWidth() / dpb;
+        int addrS = this->ctx.cmd.sy * lineBytes;
+        int addrD = this->ctx.cmd.dy * lineBytes;
+        for (int i = 0; i < steps; i++) {
+            unsigned char d = this->readLogicalPixel(addrS + this->ctx.cmd.sx / dpb, dpb, this->ctx.cmd.sx);
+            this->renderLogicalPixel(addrD + this->ctx.cmd.dx / dpb, dpb, this->ctx.cmd.dx, d, this->ctx.commandL);
+            this->ctx.cmd.sx += this->ctx.cmd.dix;
+            this->ctx.cmd.dx += this->ctx.cmd.dix;
+        }
+        this->ctx.cmd.nx -= steps;
+        this->commandDots -= (steps - 1) * 120;
+        this->addCommandWait(120);
+    }
+
     inline void executeCommandLMMV(bool setup)
     {
         if (!this->isBitmapMode()) {
@@ -2418,6 +3480,30 @@ class V9958
         this->commandMoveD(64);
     }
 
+    inline void executeCommandLMMVSpan()
+    {
+        // execute the steps that do not reach the end of the line at once (each step needs 96 dots)
+        int dpb = this->getDotPerByteX();
+        int steps = 0;
+        if (dpb) {
+            steps = this->getCommandStepsInLine(this->ctx.cmd.dx, this->ctx.cmd.dix) - 1;
+            steps = this->min(steps, 1 + this->commandDots / 96);
+        }
+        if (steps < 1) {
+            this->executeCommandLMMV(false);
+            return;
+        }
+        int addr = this->ctx.cmd.dy * (this->getScreenWidth() / dpb);
+        unsigned char clr = this->ctx.reg[44];
+        for (int i = 0; i < steps; i++) {
+            this->renderLogicalPixel(addr + this->ctx.cmd.dx / dpb, dpb, this->ctx.cmd.dx, clr, this->ctx.commandL);
+            this->ctx.cmd.dx += this->ctx.cmd.dix;
+        }
+        this->ctx.cmd.nx -= steps;
+        this->commandDots -= (steps - 1) * 96;
+        this->addCommandWait(96);
+    }
+
     inline void executeCommandLINE(bool setup)
     {
         int dpb = this->getDotPerByteX();
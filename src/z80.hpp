@@ -45,9 +45,18 @@
 #include <stdexcept>
 #endif
 
-class Z80
+// Bus: void = access memory and I/O through the callbacks (Z80),
+//      otherwise a type providing the static functions below which are called instead of the callbacks
+//        static unsigned char read(void* arg, unsigned short addr);
+//        static void write(void* arg, unsigned short addr, unsigned char value);
+//        static unsigned char in(void* arg, unsigned short port);
+//        static void out(void* arg, unsigned short port, unsigned char value);
+template <class Bus = void>
+class Z80Template
 {
   public: // Interface data types
+    typedef Z80Template<Bus> Z80;
+
     struct WaitClocks {
         int fetch;  // Wait T-cycle (Hz) before fetching instruction (default is 0 = no wait)
         int fetchM; // Wait T-cycle (Hz) before fetching multi-bytes instruction (default is 0 = no wait)
@@ -99,11 +108,11 @@ class Z80
     {
 #ifndef Z80_DISABLE_BREAKPOINT
         if (clock && wtc.read) consumeClock(wtc.read);
-        unsigned char byte = CB.read(CB.arg, addr);
+        unsigned char byte = busRead(addr);
         if (clock) consumeClock(clock);
 #else
         consumeClock(wtc.read);
-        unsigned char byte = CB.read(CB.arg, addr);
+        unsigned char byte = busRead(addr);
         consumeClock(clock);
 #endif
         return byte;
@@ -112,7 +121,7 @@ class Z80
     inline void writeByte(unsigned short addr, unsigned char value, int clock = 4)
     {
         consumeClock(wtc.write);
-        CB.write(CB.arg, addr, value);
+        busWrite(addr, value);
         consumeClock(clock);
     }
 
@@ -287,6 +296,8 @@ class Z80
 #ifndef Z80_DISABLE_BREAKPOINT
         std::map<int, std::vector<BreakPoint*>*> breakPoints;
         std::map<int, std::vector<BreakOperand*>*> breakOperands;
+        unsigned char breakPointMap[0x10000 / 8] = {};   // bit on = breakPoints has the address
+        unsigned char breakOperandMap[7][0x100 / 8] = {}; // bit on = breakOperands has the operand (index: breakOperandPrefixIndex)
 #endif
 #ifndef Z80_DISABLE_NESTCHECK
         std::vector<SimpleHandler*> returnHandlers;
@@ -296,18 +307,63 @@ class Z80
         void* arg;
     } CB;
 
+    // Memory and I/O access: via CB when Bus is void, otherwise via the static functions of Bus (inlined)
+    inline unsigned char busRead(unsigned short addr) { return busRead((Bus*)nullptr, addr); }
+    inline void busWrite(unsigned short addr, unsigned char value) { busWrite((Bus*)nullptr, addr, value); }
+    inline unsigned char busIn(unsigned short port) { return busIn((Bus*)nullptr, port); }
+    inline void busOut(unsigned short port, unsigned char value) { busOut((Bus*)nullptr, port, value); }
+    inline unsigned char busRead(void*, unsigned short addr) { return CB.read(CB.arg, addr); }
+    inline void busWrite(void*, unsigned short addr, unsigned char value) { CB.write(CB.arg, addr, value); }
+    inline unsigned char busIn(void*, unsigned short port) { return CB.in(CB.arg, port); }
+    inline void busOut(void*, unsigned short port, unsigned char value) { CB.out(CB.arg, port, value); }
+    template <class B>
+    inline unsigned char busRead(B*, unsigned short addr) { return B::read(CB.arg, addr); }
+    template <class B>
+    inline void busWrite(B*, unsigned short addr, unsigned char value) { B::write(CB.arg, addr, value); }
+    template <class B>
+    inline unsigned char busIn(B*, unsigned short port) { return B::in(CB.arg, port); }
+    template <class B>
+    inline void busOut(B*, unsigned short port, unsigned char value) { B::out(CB.arg, port, value); }
+
     bool requestBreakFlag;
 
 #ifndef Z80_DISABLE_BREAKPOINT
     inline void checkBreakPoint()
     {
+        if (0 == (CB.breakPointMap[reg.PC >> 3] & (1 << (reg.PC & 7)))) return;
         auto it = CB.breakPoints.find(reg.PC);
         if (it == CB.breakPoints.end()) return;
-        for (auto bp : *CB.breakPoints[reg.PC]) {
+        for (auto bp : *it->second) {
             bp->callback(CB.arg);
         }
     }
 
+    inline int breakOperandPrefixIndex(int operandNumber)
+    {
+        switch (operandNumber >> 8) {
+            case 0x00: return 0;
+            case 0xCB: return 1;
+            case 0xED: return 2;
+            case 0xDD: return 3;
+            case 0xFD: return 4;
+            case 0xDDCB: return 5;
+            case 0xFDCB: return 6;
+            default: return -1;
+        }
+    }
+
+    inline void updateBreakOperandMap(int operandNumber, bool on)
+    {
+        int index = breakOperandPrefixIndex(operandNumber);
+        if (index < 0) return;
+        unsigned char bit = 1 << (operandNumber & 7);
+        if (on) {
+            CB.breakOperandMap[index][(operandNumber & 0xFF) >> 3] |= bit;
+        } else {
+            CB.breakOperandMap[index][(operandNumber & 0xFF) >> 3] &= ~bit;
+        }
+    }
+
     inline void readFullOpcode(BreakOperand* operand, unsigned char* opcode, int* opcodeLength)
     {
         *opcodeLength = 0;
@@ -365,15 +421,15 @@ class Z80
         }
     }
 
-    inline void checkBreakOperand(int operandNumber)
+    inline void checkBreakOperand(int index, int operandNumber)
     {
-        if (CB.breakOperands.empty()) return;
+        if (0 == (CB.breakOperandMap[index][(operandNumber & 0xFF) >> 3] & (1 << (operandNumber & 7)))) return;
         auto it = CB.breakOperands.find(operandNumber);
         if (it == CB.breakOperands.end()) return;
         unsigned char opcode[16];
         int opcodeLength = 16;
         bool first = true;
-        for (auto bo : *CB.breakOperands[operandNumber]) {
+        for (auto bo : *it->second) {
             if (first) {
                 readFullOpcode(bo, opcode, &opcodeLength);
                 first = false;
@@ -382,12 +438,13 @@ class Z80
         }
     }
 
-    inline void checkBreakOperandCB(unsigned char operandNumber) { checkBreakOperand(0xCB00 | operandNumber); }
-    inline void checkBreakOperandED(unsigned char operandNumber) { checkBreakOperand(0xED00 | operandNumber); }
-    inline void checkBreakOperandIX(unsigned char operandNumber) { checkBreakOperand(0xDD00 | operandNumber); }
-    inline void checkBreakOperandIY(unsigned char operandNumber) { checkBreakOperand(0xFD00 | operandNumber); }
-    inline void checkBreakOperandIX4(unsigned char operandNumber) { checkBreakOperand(0xDDCB00 | operandNumber); }
-    inline void checkBreakOperandIY4(unsigned char operandNumber) { checkBreakOperand(0xFDCB00 | operandNumber); }
+    inline void checkBreakOperand(unsigned char operandNumber) { checkBreakOperand(0, operandNumber); }
+    inline void checkBreakOperandCB(unsigned char operandNumber) { checkBreakOperand(1, 0xCB00 | operandNumber); }
+    inline void checkBreakOperandED(unsigned char operandNumber) { checkBreakOperand(2, 0xED00 | operandNumber); }
+    inline void checkBreakOperandIX(unsigned char operandNumber) { checkBreakOperand(3, 0xDD00 | operandNumber); }
+    inline void checkBreakOperandIY(unsigned char operandNumber) { checkBreakOperand(4, 0xFD00 | operandNumber); }
+    inline void checkBreakOperandIX4(unsigned char operandNumber) { checkBreakOperand(5, 0xDDCB00 | operandNumber); }
+    inline void checkBreakOperandIY4(unsigned char operandNumber) { checkBreakOperand(6, 0xFDCB00 | operandNumber); }
 #endif
 
 #ifndef Z80_DISABLE_DEBUG
@@ -511,9 +568,9 @@ class Z80
     inline unsigned char inPortWithB(unsigned char port, int clock = 4)
     {
 #ifdef Z80_UNSUPPORT_16BIT_PORT
-        unsigned char byte = CB.in(CB.arg, port);
+        unsigned char byte = busIn(port);
 #else
-        unsigned char byte = CB.in(CB.arg, CB.returnPortAs16Bits ? getPort16WithB(port) : port);
+        unsigned char byte = busIn(CB.returnPortAs16Bits ? getPort16WithB(port) : port);
 #endif
         consumeClock(clock);
         return byte;
@@ -522,9 +579,9 @@ class Z80
     inline unsigned char inPortWithA(unsigned char port, int clock = 4)
     {
 #ifdef Z80_UNSUPPORT_16BIT_PORT
-        unsigned char byte = CB.in(CB.arg, port);
+        unsigned char byte = busIn(port);
 #else
-        unsigned char byte = CB.in(CB.arg, CB.returnPortAs16Bits ? getPort16WithA(port) : port);
+        unsigned char byte = busIn(CB.returnPortAs16Bits ? getPort16WithA(port) : port);
 #endif
         consumeClock(clock);
         return byte;
@@ -533,9 +590,9 @@ class Z80
     inline void outPortWithB(unsigned char port, unsigned char value, int clock = 4)
     {
 #ifdef Z80_UNSUPPORT_16BIT_PORT
-        CB.out(CB.arg, port, value);
+        busOut(port, value);
 #else
-        CB.out(CB.arg, CB.returnPortAs16Bits ? getPort16WithB(port) : port, value);
+        busOut(CB.returnPortAs16Bits ? getPort16WithB(port) : port, value);
 #endif
         consumeClock(clock);
     }
@@ -543,9 +600,9 @@ class Z80
     inline void outPortWithA(unsigned char port, unsigned char value, int clock = 4)
     {
 #ifdef Z80_UNSUPPORT_16BIT_PORT
-        CB.out(CB.arg, port, value);
+        busOut(port, value);
 #else
-        CB.out(CB.arg, CB.returnPortAs16Bits ? getPort16WithA(port) : port, value);
+        busOut(CB.returnPortAs16Bits ? getPort16WithA(port) : port, value);
 #endif
         consumeClock(clock);
     }
@@ -6029,19 +6086,19 @@ class Z80
 
   public: // API functions
 #ifdef Z80_NO_FUNCTIONAL
-    Z80(unsigned char (*read)(void* arg, unsigned short addr),
-        void (*write)(void* arg, unsigned short addr, unsigned char value),
-        unsigned char (*in)(void* arg, unsigned short port),
-        void (*out)(void* arg, unsigned short port, unsigned char value),
-        void* arg,
-        bool returnPortAs16Bits = false)
+    Z80Template(unsigned char (*read)(void* arg, unsigned short addr),
+                void (*write)(void* arg, unsigned short addr, unsigned char value),
+                unsigned char (*in)(void* arg, unsigned short port),
+                void (*out)(void* arg, unsigned short port, unsigned char value),
+                void* arg,
+                bool returnPortAs16Bits = false)
 #else
-    Z80(std::function<unsigned char(void*, unsigned short)> read,
-        std::function<void(void*, unsigned short, unsigned char)> write,
-        std::function<unsigned char(void*, unsigned short)> in,
-        std::function<void(void*, unsigned short, unsigned char)> out,
-        void* arg,
-        bool returnPortAs16Bits = false)
+    Z80Template(std::function<unsigned char(void*, unsigned short)> read,
+                std::function<void(void*, unsigned short, unsigned char)> write,
+                std::function<unsigned char(void*, unsigned short)> in,
+                std::function<void(void*, unsigned short, unsigned char)> out,
+                void* arg,
+                bool returnPortAs16Bits = false)
 #endif
     {
         this->CB.arg = arg;
@@ -6050,13 +6107,13 @@ class Z80
     }
 
     // without setup callbacks
-    Z80(void* arg)
+    Z80Template(void* arg)
     {
         this->CB.arg = arg;
         initialize();
     }
 
-    Z80()
+    Z80Template()
     {
         initialize();
     }
@@ -6153,9 +6210,12 @@ class Z80
         reg.pair.F = 0xff;
         reg.SP = 0xffff;
         memset(&wtc, 0, sizeof(wtc));
+#ifndef Z80_UNSUPPORT_16BIT_PORT
+        CB.returnPortAs16Bits = false;
+#endif
     }
 
-    ~Z80()
+    ~Z80Template()
     {
 #ifndef Z80_DISABLE_BREAKPOINT
         removeAllBreakOperands();
@@ -6218,6 +6278,7 @@ class Z80
             CB.breakPoints[addr] = new std::vector<BreakPoint*>();
         }
         CB.breakPoints[addr]->push_back(new BreakPoint(addr, callback));
+        CB.breakPointMap[addr >> 3] |= 1 << (addr & 7);
     }
 
     void removeBreakPoint(unsigned short addr)
@@ -6227,6 +6288,7 @@ class Z80
         for (auto bp : *CB.breakPoints[addr]) delete bp;
         delete CB.breakPoints[addr];
         CB.breakPoints.erase(it);
+        CB.breakPointMap[addr >> 3] &= ~(1 << (addr & 7));
     }
 
     void removeAllBreakPoints()
@@ -6261,6 +6323,7 @@ class Z80
             CB.breakOperands[op] = new std::vector<BreakOperand*>();
         }
         CB.breakOperands[op]->push_back(new BreakOperand(prefixNumber, operandNumber, callback));
+        updateBreakOperandMap(op, true);
     }
 
 #ifdef Z80_NO_FUNCTIONAL
@@ -6283,6 +6346,7 @@ class Z80
         for (auto bo : *CB.breakOperands[operandNumber]) delete bo;
         delete CB.breakOperands[operandNumber];
         CB.breakOperands.erase(it);
+        updateBreakOperandMap(operandNumber, false);
     }
 
     void removeBreakOperand(unsigned char prefixNumber, unsigned char operandNumber)
@@ -6389,8 +6453,5299 @@ class Z80
         return result;
     }
 
+    // BEGIN: generated by tools/z80threaded (do not edit)
+#ifdef Z80_THREADED_DISPATCH
+#ifndef Z80_DISABLE_BREAKPOINT
+#define Z80_THREADED_BREAK_POINT() checkBreakPoint()
+#define Z80_THREADED_BREAK_OPERAND(check) check
+#else
+#define Z80_THREADED_BREAK_POINT()
+#define Z80_THREADED_BREAK_OPERAND(check)
+#endif
+#ifdef Z80_CALLBACK_PER_INSTRUCTION
+#ifdef Z80_CALLBACK_WITHOUT_CHECK
+#define Z80_THREADED_END_INSTRUCTION() \
+    checkInterrupt();                  \
+    CB.consumeClock(CB.arg, reg.consumeClockCounter); \
+    reg.consumeClockCounter = 0
+#else
+#define Z80_THREADED_END_INSTRUCTION()                                          \
+    checkInterrupt();                                                           \
+    if (CB.consumeClockEnabled) CB.consumeClock(CB.arg, reg.consumeClockCounter); \
+    reg.consumeClockCounter = 0
+#endif
+#else
+#define Z80_THREADED_END_INSTRUCTION() \
+    reg.consumeClockCounter = 0;       \
+    checkInterrupt()
+#endif
+// fetch the next operand and jump to its handler (every handler has its own indirect jump)
+#define Z80_THREADED_DISPATCH_NEXT()         \
+    if (reg.IFF & IFF_HALT()) goto HALTED;   \
+    if (wtc.fetch) consumeClock(wtc.fetch);  \
+    Z80_THREADED_BREAK_POINT();              \
+    reg.execEI = 0;                          \
+    operandNumber = fetch(2);                \
+    updateRefreshRegister();                 \
+    Z80_THREADED_BREAK_OPERAND(checkBreakOperand(operandNumber)); \
+    goto* labelOP1[operandNumber]
+// finish the executed instruction (same as the loop of execute) and dispatch the next operand
+#define Z80_THREADED_NEXT()                          \
+    executed += reg.consumeClockCounter;             \
+    clock -= reg.consumeClockCounter;                \
+    Z80_THREADED_END_INSTRUCTION();                  \
+    if (clock <= 0 || requestBreakFlag) return executed; \
+    Z80_THREADED_DISPATCH_NEXT()
+
+    // same as execute(int) but each operand handler is called directly and jumps to the next handler by computed goto
+    inline int executeThreaded(int clock)
+    {
+        static const void* const labelOP1[256] = {
+            &&OP1_NOP, &&OP1_LD_BC_NN, &&OP1_LD_BC_A, &&OP1_INC_RP_BC, &&OP1_INC_B, &&OP1_DEC_B, &&OP1_LD_B_N, &&OP1_RLCA,
+            &&OP1_EX_AF_AF2, &&OP1_ADD_HL_BC, &&OP1_LD_A_BC, &&OP1_DEC_RP_BC, &&OP1_INC_C, &&OP1_DEC_C, &&OP1_LD_C_N, &&OP1_RRCA,
+            &&OP1_DJNZ_E, &&OP1_LD_DE_NN, &&OP1_LD_DE_A, &&OP1_INC_RP_DE, &&OP1_INC_D, &&OP1_DEC_D, &&OP1_LD_D_N, &&OP1_RLA,
+            &&OP1_JR_E, &&OP1_ADD_HL_DE, &&OP1_LD_A_DE, &&OP1_DEC_RP_DE, &&OP1_INC_E, &&OP1_DEC_E, &&OP1_LD_E_N, &&OP1_RRA,
+            &&OP1_JR_NZ_E, &&OP1_LD_HL_NN, &&OP1_LD_ADDR_HL, &&OP1_INC_RP_HL, &&OP1_INC_H, &&OP1_DEC_H, &&OP1_LD_H_N, &&OP1_DAA,
+            &&OP1_JR_Z_E, &&OP1_ADD_HL_HL, &&OP1_LD_HL_ADDR, &&OP1_DEC_RP_HL, &&OP1_INC_L, &&OP1_DEC_L, &&OP1_LD_L_N, &&OP1_CPL,
+            &&OP1_JR_NC_E, &&OP1_LD_SP_NN, &&OP1_LD_NN_A, &&OP1_INC_RP_SP, &&OP1_INC_HL, &&OP1_DEC_HL, &&OP1_LD_HL_N, &&OP1_SCF,
+            &&OP1_JR_C_E, &&OP1_ADD_HL_SP, &&OP1_LD_A_NN, &&OP1_DEC_RP_SP, &&OP1_INC_A, &&OP1_DEC_A, &&OP1_LD_A_N, &&OP1_CCF,
+            &&OP1_LD_B_B, &&OP1_LD_B_C, &&OP1_LD_B_D, &&OP1_LD_B_E, &&OP1_LD_B_H, &&OP1_LD_B_L, &&OP1_LD_B_HL, &&OP1_LD_B_A,
+            &&OP1_LD_C_B, &&OP1_LD_C_C, &&OP1_LD_C_D, &&OP1_LD_C_E, &&OP1_LD_C_H, &&OP1_LD_C_L, &&OP1_LD_C_HL, &&OP1_LD_C_A,
+            &&OP1_LD_D_B, &&OP1_LD_D_C, &&OP1_LD_D_D, &&OP1_LD_D_E, &&OP1_LD_D_H, &&OP1_LD_D_L, &&OP1_LD_D_HL, &&OP1_LD_D_A,
+            &&OP1_LD_E_B, &&OP1_LD_E_C, &&OP1_LD_E_D, &&OP1_LD_E_E, &&OP1_LD_E_H, &&OP1_LD_E_L, &&OP1_LD_E_HL, &&OP1_LD_E_A,
+            &&OP1_LD_H_B, &&OP1_LD_H_C, &&OP1_LD_H_D, &&OP1_LD_H_E, &&OP1_LD_H_H, &&OP1_LD_H_L, &&OP1_LD_H_HL, &&OP1_LD_H_A,
+            &&OP1_LD_L_B, &&OP1_LD_L_C, &&OP1_LD_L_D, &&OP1_LD_L_E, &&OP1_LD_L_H, &&OP1_LD_L_L, &&OP1_LD_L_HL, &&OP1_LD_L_A,
+            &&OP1_LD_HL_B, &&OP1_LD_HL_C, &&OP1_LD_HL_D, &&OP1_LD_HL_E, &&OP1_LD_HL_H, &&OP1_LD_HL_L, &&OP1_HALT, &&OP1_LD_HL_A,
+            &&OP1_LD_A_B, &&OP1_LD_A_C, &&OP1_LD_A_D, &&OP1_LD_A_E, &&OP1_LD_A_H, &&OP1_LD_A_L, &&OP1_LD_A_HL, &&OP1_LD_A_A,
+            &&OP1_ADD_B, &&OP1_ADD_C, &&OP1_ADD_D, &&OP1_ADD_E, &&OP1_ADD_H, &&OP1_ADD_L, &&OP1_ADD_HL, &&OP1_ADD_A,
+            &&OP1_ADC_B, &&OP1_ADC_C, &&OP1_ADC_D, &&OP1_ADC_E, &&OP1_ADC_H, &&OP1_ADC_L, &&OP1_ADC_HL, &&OP1_ADC_A,
+            &&OP1_SUB_B, &&OP1_SUB_C, &&OP1_SUB_D, &&OP1_SUB_E, &&OP1_SUB_H, &&OP1_SUB_L, &&OP1_SUB_HL, &&OP1_SUB_A,
+            &&OP1_SBC_B, &&OP1_SBC_C, &&OP1_SBC_D, &&OP1_SBC_E, &&OP1_SBC_H, &&OP1_SBC_L, &&OP1_SBC_HL, &&OP1_SBC_A,
+            &&OP1_AND_B, &&OP1_AND_C, &&OP1_AND_D, &&OP1_AND_E, &&OP1_AND_H, &&OP1_AND_L, &&OP1_AND_HL, &&OP1_AND_A,
+            &&OP1_XOR_B, &&OP1_XOR_C, &&OP1_XOR_D, &&OP1_XOR_E, &&OP1_XOR_H, &&OP1_XOR_L, &&OP1_XOR_HL, &&OP1_XOR_A,
+            &&OP1_OR_B, &&OP1_OR_C, &&OP1_OR_D, &&OP1_OR_E, &&OP1_OR_H, &&OP1_OR_L, &&OP1_OR_HL, &&OP1_OR_A,
+            &&OP1_CP_B, &&OP1_CP_C, &&OP1_CP_D, &&OP1_CP_E, &&OP1_CP_H, &&OP1_CP_L, &&OP1_CP_HL, &&OP1_CP_A,
+            &&OP1_RET_C0, &&OP1_POP_BC, &&OP1_JP_C0_NN, &&OP1_JP_NN, &&OP1_CALL_C0_NN, &&OP1_PUSH_BC, &&OP1_ADD_N, &&OP1_RST00,
+            &&OP1_RET_C1, &&OP1_RET, &&OP1_JP_C1_NN, &&OP1_OP_CB, &&OP1_CALL_C1_NN, &&OP1_CALL_NN, &&OP1_ADC_N, &&OP1_RST08,
+            &&OP1_RET_C2, &&OP1_POP_DE, &&OP1_JP_C2_NN, &&OP1_OUT_N_A, &&OP1_CALL_C2_NN, &&OP1_PUSH_DE, &&OP1_SUB_N, &&OP1_RST10,
+            &&OP1_RET_C3, &&OP1_EXX, &&OP1_JP_C3_NN, &&OP1_IN_A_N, &&OP1_CALL_C3_NN, &&OP1_OP_IX, &&OP1_SBC_N, &&OP1_RST18,
+            &&OP1_RET_C4, &&OP1_POP_HL, &&OP1_JP_C4_NN, &&OP1_EX_SP_HL, &&OP1_CALL_C4_NN, &&OP1_PUSH_HL, &&OP1_AND_N, &&OP1_RST20,
+            &&OP1_RET_C5, &&OP1_JP_HL, &&OP1_JP_C5_NN, &&OP1_EX_DE_HL, &&OP1_CALL_C5_NN, &&OP1_OP_ED, &&OP1_XOR_N, &&OP1_RST28,
+            &&OP1_RET_C6, &&OP1_POP_AF, &&OP1_JP_C6_NN, &&OP1_DI, &&OP1_CALL_C6_NN, &&OP1_PUSH_AF, &&OP1_OR_N, &&OP1_RST30,
+            &&OP1_RET_C7, &&OP1_LD_SP_HL, &&OP1_JP_C7_NN, &&OP1_EI, &&OP1_CALL_C7_NN, &&OP1_OP_IY, &&OP1_CP_N, &&OP1_RST38};
+        static const void* const labelCB[256] = {
+            &&CB_RLC_B, &&CB_RLC_C, &&CB_RLC_D, &&CB_RLC_E, &&CB_RLC_H, &&CB_RLC_L, &&CB_RLC_HL_, &&CB_RLC_A,
+            &&CB_RRC_B, &&CB_RRC_C, &&CB_RRC_D, &&CB_RRC_E, &&CB_RRC_H, &&CB_RRC_L, &&CB_RRC_HL_, &&CB_RRC_A,
+            &&CB_RL_B, &&CB_RL_C, &&CB_RL_D, &&CB_RL_E, &&CB_RL_H, &&CB_RL_L, &&CB_RL_HL_, &&CB_RL_A,
+            &&CB_RR_B, &&CB_RR_C, &&CB_RR_D, &&CB_RR_E, &&CB_RR_H, &&CB_RR_L, &&CB_RR_HL_, &&CB_RR_A,
+            &&CB_SLA_B, &&CB_SLA_C, &&CB_SLA_D, &&CB_SLA_E, &&CB_SLA_H, &&CB_SLA_L, &&CB_SLA_HL_, &&CB_SLA_A,
+            &&CB_SRA_B, &&CB_SRA_C, &&CB_SRA_D, &&CB_SRA_E, &&CB_SRA_H, &&CB_SRA_L, &&CB_SRA_HL_, &&CB_SRA_A,
+            &&CB_SLL_B, &&CB_SLL_C, &&CB_SLL_D, &&CB_SLL_E, &&CB_SLL_H, &&CB_SLL_L, &&CB_SLL_HL_, &&CB_SLL_A,
+            &&CB_SRL_B, &&CB_SRL_C, &&CB_SRL_D, &&CB_SRL_E, &&CB_SRL_H, &&CB_SRL_L, &&CB_SRL_HL_, &&CB_SRL_A,
+            &&CB_BIT_B_0, &&CB_BIT_C_0, &&CB_BIT_D_0, &&CB_BIT_E_0, &&CB_BIT_H_0, &&CB_BIT_L_0, &&CB_BIT_HL_0, &&CB_BIT_A_0,
+            &&CB_BIT_B_1, &&CB_BIT_C_1, &&CB_BIT_D_1, &&CB_BIT_E_1, &&CB_BIT_H_1, &&CB_BIT_L_1, &&CB_BIT_HL_1, &&CB_BIT_A_1,
+            &&CB_BIT_B_2, &&CB_BIT_C_2, &&CB_BIT_D_2, &&CB_BIT_E_2, &&CB_BIT_H_2, &&CB_BIT_L_2, &&CB_BIT_HL_2, &&CB_BIT_A_2,
+            &&CB_BIT_B_3, &&CB_BIT_C_3, &&CB_BIT_D_3, &&CB_BIT_E_3, &&CB_BIT_H_3, &&CB_BIT_L_3, &&CB_BIT_HL_3, &&CB_BIT_A_3,
+            &&CB_BIT_B_4, &&CB_BIT_C_4, &&CB_BIT_D_4, &&CB_BIT_E_4, &&CB_BIT_H_4, &&CB_BIT_L_4, &&CB_BIT_HL_4, &&CB_BIT_A_4,
+            &&CB_BIT_B_5, &&CB_BIT_C_5, &&CB_BIT_D_5, &&CB_BIT_E_5, &&CB_BIT_H_5, &&CB_BIT_L_5, &&CB_BIT_HL_5, &&CB_BIT_A_5,
+            &&CB_BIT_B_6, &&CB_BIT_C_6, &&CB_BIT_D_6, &&CB_BIT_E_6, &&CB_BIT_H_6, &&CB_BIT_L_6, &&CB_BIT_HL_6, &&CB_BIT_A_6,
+            &&CB_BIT_B_7, &&CB_BIT_C_7, &&CB_BIT_D_7, &&CB_BIT_E_7, &&CB_BIT_H_7, &&CB_BIT_L_7, &&CB_BIT_HL_7, &&CB_BIT_A_7,
+            &&CB_RES_B_0, &&CB_RES_C_0, &&CB_RES_D_0, &&CB_RES_E_0, &&CB_RES_H_0, &&CB_RES_L_0, &&CB_RES_HL_0, &&CB_RES_A_0,
+            &&CB_RES_B_1, &&CB_RES_C_1, &&CB_RES_D_1, &&CB_RES_E_1, &&CB_RES_H_1, &&CB_RES_L_1, &&CB_RES_HL_1, &&CB_RES_A_1,
+            &&CB_RES_B_2, &&CB_RES_C_2, &&CB_RES_D_2, &&CB_RES_E_2, &&CB_RES_H_2, &&CB_RES_L_2, &&CB_RES_HL_2, &&CB_RES_A_2,
+            &&CB_RES_B_3, &&CB_RES_C_3, &&CB_RES_D_3, &&CB_RES_E_3, &&CB_RES_H_3, &&CB_RES_L_3, &&CB_RES_HL_3, &&CB_RES_A_3,
+            &&CB_RES_B_4, &&CB_RES_C_4, &&CB_RES_D_4, &&CB_RES_E_4, &&CB_RES_H_4, &&CB_RES_L_4, &&CB_RES_HL_4, &&CB_RES_A_4,
+            &&CB_RES_B_5, &&CB_RES_C_5, &&CB_RES_D_5, &&CB_RES_E_5, &&CB_RES_H_5, &&CB_RES_L_5, &&CB_RES_HL_5, &&CB_RES_A_5,
+            &&CB_RES_B_6, &&CB_RES_C_6, &&CB_RES_D_6, &&CB_RES_E_6, &&CB_RES_H_6, &&CB_RES_L_6, &&CB_RES_HL_6, &&CB_RES_A_6,
+            &&CB_RES_B_7, &&CB_RES_C_7, &&CB_RES_D_7, &&CB_RES_E_7, &&CB_RES_H_7, &&CB_RES_L_7, &&CB_RES_HL_7, &&CB_RES_A_7,
+            &&CB_SET_B_0, &&CB_SET_C_0, &&CB_SET_D_0, &&CB_SET_E_0, &&CB_SET_H_0, &&CB_SET_L_0, &&CB_SET_HL_0, &&CB_SET_A_0,
+            &&CB_SET_B_1, &&CB_SET_C_1, &&CB_SET_D_1, &&CB_SET_E_1, &&CB_SET_H_1, &&CB_SET_L_1, &&CB_SET_HL_1, &&CB_SET_A_1,
+            &&CB_SET_B_2, &&CB_SET_C_2, &&CB_SET_D_2, &&CB_SET_E_2, &&CB_SET_H_2, &&CB_SET_L_2, &&CB_SET_HL_2, &&CB_SET_A_2,
+            &&CB_SET_B_3, &&CB_SET_C_3, &&CB_SET_D_3, &&CB_SET_E_3, &&CB_SET_H_3, &&CB_SET_L_3, &&CB_SET_HL_3, &&CB_SET_A_3,
+            &&CB_SET_B_4, &&CB_SET_C_4, &&CB_SET_D_4, &&CB_SET_E_4, &&CB_SET_H_4, &&CB_SET_L_4, &&CB_SET_HL_4, &&CB_SET_A_4,
+            &&CB_SET_B_5, &&CB_SET_C_5, &&CB_SET_D_5, &&CB_SET_E_5, &&CB_SET_H_5, &&CB_SET_L_5, &&CB_SET_HL_5, &&CB_SET_A_5,
+            &&CB_SET_B_6, &&CB_SET_C_6, &&CB_SET_D_6, &&CB_SET_E_6, &&CB_SET_H_6, &&CB_SET_L_6, &&CB_SET_HL_6, &&CB_SET_A_6,
+            &&CB_SET_B_7, &&CB_SET_C_7, &&CB_SET_D_7, &&CB_SET_E_7, &&CB_SET_H_7, &&CB_SET_L_7, &&CB_SET_HL_7, &&CB_SET_A_7};
+        static const void* const labelED[256] = {
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_IN_B_C, &&ED_OUT_C_B, &&ED_SBC_HL_BC, &&ED_LD_ADDR_RP_BC, &&ED_NEG_, &&ED_RETN_, &&ED_IM0, &&ED_LD_I_A_,
+            &&ED_IN_C_C, &&ED_OUT_C_C, &&ED_ADC_HL_BC, &&ED_LD_RP_ADDR_BC, &&ED_UNKNOWN, &&ED_RETI_, &&ED_UNKNOWN, &&ED_LD_R_A_,
+            &&ED_IN_D_C, &&ED_OUT_C_D, &&ED_SBC_HL_DE, &&ED_LD_ADDR_RP_DE, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_IM1, &&ED_LD_A_I_,
+            &&ED_IN_E_C, &&ED_OUT_C_E, &&ED_ADC_HL_DE, &&ED_LD_RP_ADDR_DE, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_IM2, &&ED_LD_A_R_,
+            &&ED_IN_H_C, &&ED_OUT_C_H, &&ED_SBC_HL_HL, &&ED_LD_ADDR_RP_HL, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_RRD_,
+            &&ED_IN_L_C, &&ED_OUT_C_L, &&ED_ADC_HL_HL, &&ED_LD_RP_ADDR_HL, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_RLD_,
+            &&ED_IN_C, &&ED_OUT_C_0, &&ED_SBC_HL_SP, &&ED_LD_ADDR_RP_SP, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_IN_A_C, &&ED_OUT_C_A, &&ED_ADC_HL_SP, &&ED_LD_RP_ADDR_SP, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_LDI, &&ED_CPI, &&ED_INI, &&ED_OUTI, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_LDD, &&ED_CPD, &&ED_IND, &&ED_OUTD, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_LDIR, &&ED_CPIR, &&ED_INIR, &&ED_OUTIR, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_LDDR, &&ED_CPDR, &&ED_INDR, &&ED_OUTDR, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN,
+            &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN, &&ED_UNKNOWN};
+        static const void* const labelIX[256] = {
+            &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_INC_B_2, &&IX_DEC_B_2, &&IX_LD_B_N_3, &&IX_UNKNOWN,
+            &&IX_UNKNOWN, &&IX_ADD_IX_BC, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_INC_C_2, &&IX_DEC_C_2, &&IX_LD_C_N_3, &&IX_UNKNOWN,
+            &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_INC_D_2, &&IX_DEC_D_2, &&IX_LD_D_N_3, &&IX_UNKNOWN,
+            &&IX_UNKNOWN, &&IX_ADD_IX_DE, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_INC_E_2, &&IX_DEC_E_2, &&IX_LD_E_N_3, &&IX_UNKNOWN,
+            &&IX_UNKNOWN, &&IX_LD_IX_NN_, &&IX_LD_ADDR_IX_, &&IX_INC_IX_reg_, &&IX_INC_IXH_, &&IX_DEC_IXH_, &&IX_LD_IXH_N_, &&IX_UNKNOWN,
+            &&IX_UNKNOWN, &&IX_ADD_IX_IX, &&IX_LD_IX_ADDR_, &&IX_DEC_IX_reg_, &&IX_INC_IXL_, &&IX_DEC_IXL_, &&IX_LD_IXL_N_, &&IX_UNKNOWN,
+            &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_INC_IX_, &&IX_DEC_IX_, &&IX_LD_IX_N_, &&IX_UNKNOWN,
+            &&IX_UNKNOWN, &&IX_ADD_IX_SP, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_INC_A_2, &&IX_DEC_A_2, &&IX_LD_A_N_3, &&IX_UNKNOWN,
+            &&IX_LD_B_B_2, &&IX_LD_B_C_2, &&IX_LD_B_D_2, &&IX_LD_B_E_2, &&IX_LD_B_IXH, &&IX_LD_B_IXL, &&IX_LD_B_IX, &&IX_LD_B_A_2,
+            &&IX_LD_C_B_2, &&IX_LD_C_C_2, &&IX_LD_C_D_2, &&IX_LD_C_E_2, &&IX_LD_C_IXH, &&IX_LD_C_IXL, &&IX_LD_C_IX, &&IX_LD_C_A_2,
+            &&IX_LD_D_B_2, &&IX_LD_D_C_2, &&IX_LD_D_D_2, &&IX_LD_D_E_2, &&IX_LD_D_IXH, &&IX_LD_D_IXL, &&IX_LD_D_IX, &&IX_LD_D_A_2,
+            &&IX_LD_E_B_2, &&IX_LD_E_C_2, &&IX_LD_E_D_2, &&IX_LD_E_E_2, &&IX_LD_E_IXH, &&IX_LD_E_IXL, &&IX_LD_E_IX, &&IX_LD_E_A_2,
+            &&IX_LD_IXH_B, &&IX_LD_IXH_C, &&IX_LD_IXH_D, &&IX_LD_IXH_E, &&IX_LD_IXH_IXH_, &&IX_LD_IXH_IXL_, &&IX_LD_H_IX, &&IX_LD_IXH_A,
+            &&IX_LD_IXL_B, &&IX_LD_IXL_C, &&IX_LD_IXL_D, &&IX_LD_IXL_E, &&IX_LD_IXL_IXH_, &&IX_LD_IXL_IXL_, &&IX_LD_L_IX, &&IX_LD_IXL_A,
+            &&IX_LD_IX_B, &&IX_LD_IX_C, &&IX_LD_IX_D, &&IX_LD_IX_E, &&IX_LD_IX_H, &&IX_LD_IX_L, &&IX_UNKNOWN, &&IX_LD_IX_A,
+            &&IX_LD_A_B_2, &&IX_LD_A_C_2, &&IX_LD_A_D_2, &&IX_LD_A_E_2, &&IX_LD_A_IXH, &&IX_LD_A_IXL, &&IX_LD_A_IX, &&IX_LD_A_A_2,
+            &&IX_ADD_B_2, &&IX_ADD_C_2, &&IX_ADD_D_2, &&IX_ADD_E_2, &&IX_ADD_IXH_, &&IX_ADD_IXL_, &&IX_ADD_IX_, &&IX_ADD_A_2,
+            &&IX_ADC_B_2, &&IX_ADC_C_2, &&IX_ADC_D_2, &&IX_ADC_E_2, &&IX_ADC_IXH_, &&IX_ADC_IXL_, &&IX_ADC_IX_, &&IX_ADC_A_2,
+            &&IX_SUB_B_2, &&IX_SUB_C_2, &&IX_SUB_D_2, &&IX_SUB_E_2, &&IX_SUB_IXH_, &&IX_SUB_IXL_, &&IX_SUB_IX_, &&IX_SUB_A_2,
+            &&IX_SBC_B_2, &&IX_SBC_C_2, &&IX_SBC_D_2, &&IX_SBC_E_2, &&IX_SBC_IXH_, &&IX_SBC_IXL_, &&IX_SBC_IX_, &&IX_SBC_A_2,
+            &&IX_AND_B_2, &&IX_AND_C_2, &&IX_AND_D_2, &&IX_AND_E_2, &&IX_AND_IXH_, &&IX_AND_IXL_, &&IX_AND_IX_, &&IX_AND_A_2,
+            &&IX_XOR_B_2, &&IX_XOR_C_2, &&IX_XOR_D_2, &&IX_XOR_E_2, &&IX_XOR_IXH_, &&IX_XOR_IXL_, &&IX_XOR_IX_, &&IX_XOR_A_2,
+            &&IX_OR_B_2, &&IX_OR_C_2, &&IX_OR_D_2, &&IX_OR_E_2, &&IX_OR_IXH_, &&IX_OR_IXL_, &&IX_OR_IX_, &&IX_OR_A_2,
+            &&IX_CP_B_2, &&IX_CP_C_2, &&IX_CP_D_2, &&IX_CP_E_2, &&IX_CP_IXH_, &&IX_CP_IXL_, &&IX_CP_IX_, &&IX_CP_A_2,
+            &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN,
+            &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_OP_IX4, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN,
+            &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN,
+            &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN,
+            &&IX_UNKNOWN, &&IX_POP_IX_, &&IX_UNKNOWN, &&IX_EX_SP_IX_, &&IX_UNKNOWN, &&IX_PUSH_IX_, &&IX_UNKNOWN, &&IX_UNKNOWN,
+            &&IX_UNKNOWN, &&IX_JP_IX, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN,
+            &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN,
+            &&IX_UNKNOWN, &&IX_LD_SP_IX_, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN, &&IX_UNKNOWN};
+        static const void* const labelIY[256] = {
+            &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_INC_B_2, &&IY_DEC_B_2, &&IY_LD_B_N_3, &&IY_UNKNOWN,
+            &&IY_UNKNOWN, &&IY_ADD_IY_BC, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_INC_C_2, &&IY_DEC_C_2, &&IY_LD_C_N_3, &&IY_UNKNOWN,
+            &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_INC_D_2, &&IY_DEC_D_2, &&IY_LD_D_N_3, &&IY_UNKNOWN,
+            &&IY_UNKNOWN, &&IY_ADD_IY_DE, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_INC_E_2, &&IY_DEC_E_2, &&IY_LD_E_N_3, &&IY_UNKNOWN,
+            &&IY_UNKNOWN, &&IY_LD_IY_NN_, &&IY_LD_ADDR_IY_, &&IY_INC_IY_reg_, &&IY_INC_IYH_, &&IY_DEC_IYH_, &&IY_LD_IYH_N_, &&IY_UNKNOWN,
+            &&IY_UNKNOWN, &&IY_ADD_IY_IY, &&IY_LD_IY_ADDR_, &&IY_DEC_IY_reg_, &&IY_INC_IYL_, &&IY_DEC_IYL_, &&IY_LD_IYL_N_, &&IY_UNKNOWN,
+            &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_INC_IY_, &&IY_DEC_IY_, &&IY_LD_IY_N_, &&IY_UNKNOWN,
+            &&IY_UNKNOWN, &&IY_ADD_IY_SP, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_INC_A_2, &&IY_DEC_A_2, &&IY_LD_A_N_3, &&IY_UNKNOWN,
+            &&IY_LD_B_B_2, &&IY_LD_B_C_2, &&IY_LD_B_D_2, &&IY_LD_B_E_2, &&IY_LD_B_IYH, &&IY_LD_B_IYL, &&IY_LD_B_IY, &&IY_LD_B_A_2,
+            &&IY_LD_C_B_2, &&IY_LD_C_C_2, &&IY_LD_C_D_2, &&IY_LD_C_E_2, &&IY_LD_C_IYH, &&IY_LD_C_IYL, &&IY_LD_C_IY, &&IY_LD_C_A_2,
+            &&IY_LD_D_B_2, &&IY_LD_D_C_2, &&IY_LD_D_D_2, &&IY_LD_D_E_2, &&IY_LD_D_IYH, &&IY_LD_D_IYL, &&IY_LD_D_IY, &&IY_LD_D_A_2,
+            &&IY_LD_E_B_2, &&IY_LD_E_C_2, &&IY_LD_E_D_2, &&IY_LD_E_E_2, &&IY_LD_E_IYH, &&IY_LD_E_IYL, &&IY_LD_E_IY, &&IY_LD_E_A_2,
+            &&IY_LD_IYH_B, &&IY_LD_IYH_C, &&IY_LD_IYH_D, &&IY_LD_IYH_E, &&IY_LD_IYH_IYH_, &&IY_LD_IYH_IYL_, &&IY_LD_H_IY, &&IY_LD_IYH_A,
+            &&IY_LD_IYL_B, &&IY_LD_IYL_C, &&IY_LD_IYL_D, &&IY_LD_IYL_E, &&IY_LD_IYL_IYH_, &&IY_LD_IYL_IYL_, &&IY_LD_L_IY, &&IY_LD_IYL_A,
+            &&IY_LD_IY_B, &&IY_LD_IY_C, &&IY_LD_IY_D, &&IY_LD_IY_E, &&IY_LD_IY_H, &&IY_LD_IY_L, &&IY_UNKNOWN, &&IY_LD_IY_A,
+            &&IY_LD_A_B_2, &&IY_LD_A_C_2, &&IY_LD_A_D_2, &&IY_LD_A_E_2, &&IY_LD_A_IYH, &&IY_LD_A_IYL, &&IY_LD_A_IY, &&IY_LD_A_A_2,
+            &&IY_ADD_B_2, &&IY_ADD_C_2, &&IY_ADD_D_2, &&IY_ADD_E_2, &&IY_ADD_IYH_, &&IY_ADD_IYL_, &&IY_ADD_IY_, &&IY_ADD_A_2,
+            &&IY_ADC_B_2, &&IY_ADC_C_2, &&IY_ADC_D_2, &&IY_ADC_E_2, &&IY_ADC_IYH_, &&IY_ADC_IYL_, &&IY_ADC_IY_, &&IY_ADC_A_2,
+            &&IY_SUB_B_2, &&IY_SUB_C_2, &&IY_SUB_D_2, &&IY_SUB_E_2, &&IY_SUB_IYH_, &&IY_SUB_IYL_, &&IY_SUB_IY_, &&IY_SUB_A_2,
+            &&IY_SBC_B_2, &&IY_SBC_C_2, &&IY_SBC_D_2, &&IY_SBC_E_2, &&IY_SBC_IYH_, &&IY_SBC_IYL_, &&IY_SBC_IY_, &&IY_SBC_A_2,
+            &&IY_AND_B_2, &&IY_AND_C_2, &&IY_AND_D_2, &&IY_AND_E_2, &&IY_AND_IYH_, &&IY_AND_IYL_, &&IY_AND_IY_, &&IY_AND_A_2,
+            &&IY_XOR_B_2, &&IY_XOR_C_2, &&IY_XOR_D_2, &&IY_XOR_E_2, &&IY_XOR_IYH_, &&IY_XOR_IYL_, &&IY_XOR_IY_, &&IY_XOR_A_2,
+            &&IY_OR_B_2, &&IY_OR_C_2, &&IY_OR_D_2, &&IY_OR_E_2, &&IY_OR_IYH_, &&IY_OR_IYL_, &&IY_OR_IY_, &&IY_OR_A_2,
+            &&IY_CP_B_2, &&IY_CP_C_2, &&IY_CP_D_2, &&IY_CP_E_2, &&IY_CP_IYH_, &&IY_CP_IYL_, &&IY_CP_IY_, &&IY_CP_A_2,
+            &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN,
+            &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_OP_IY4, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN,
+            &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN,
+            &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN,
+            &&IY_UNKNOWN, &&IY_POP_IY_, &&IY_UNKNOWN, &&IY_EX_SP_IY_, &&IY_UNKNOWN, &&IY_PUSH_IY_, &&IY_UNKNOWN, &&IY_UNKNOWN,
+            &&IY_UNKNOWN, &&IY_JP_IY, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN,
+            &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN,
+            &&IY_UNKNOWN, &&IY_LD_SP_IY_, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN, &&IY_UNKNOWN};
+        static const void* const labelIX4[256] = {
+            &&IX4_RLC_IX_with_LD_B, &&IX4_RLC_IX_with_LD_C, &&IX4_RLC_IX_with_LD_D, &&IX4_RLC_IX_with_LD_E, &&IX4_RLC_IX_with_LD_H, &&IX4_RLC_IX_with_LD_L, &&IX4_RLC_IX_, &&IX4_RLC_IX_with_LD_A,
+            &&IX4_RRC_IX_with_LD_B, &&IX4_RRC_IX_with_LD_C, &&IX4_RRC_IX_with_LD_D, &&IX4_RRC_IX_with_LD_E, &&IX4_RRC_IX_with_LD_H, &&IX4_RRC_IX_with_LD_L, &&IX4_RRC_IX_, &&IX4_RRC_IX_with_LD_A,
+            &&IX4_RL_IX_with_LD_B, &&IX4_RL_IX_with_LD_C, &&IX4_RL_IX_with_LD_D, &&IX4_RL_IX_with_LD_E, &&IX4_RL_IX_with_LD_H, &&IX4_RL_IX_with_LD_L, &&IX4_RL_IX_, &&IX4_RL_IX_with_LD_A,
+            &&IX4_RR_IX_with_LD_B, &&IX4_RR_IX_with_LD_C, &&IX4_RR_IX_with_LD_D, &&IX4_RR_IX_with_LD_E, &&IX4_RR_IX_with_LD_H, &&IX4_RR_IX_with_LD_L, &&IX4_RR_IX_, &&IX4_RR_IX_with_LD_A,
+            &&IX4_SLA_IX_with_LD_B, &&IX4_SLA_IX_with_LD_C, &&IX4_SLA_IX_with_LD_D, &&IX4_SLA_IX_with_LD_E, &&IX4_SLA_IX_with_LD_H, &&IX4_SLA_IX_with_LD_L, &&IX4_SLA_IX_, &&IX4_SLA_IX_with_LD_A,
+            &&IX4_SRA_IX_with_LD_B, &&IX4_SRA_IX_with_LD_C, &&IX4_SRA_IX_with_LD_D, &&IX4_SRA_IX_with_LD_E, &&IX4_SRA_IX_with_LD_H, &&IX4_SRA_IX_with_LD_L, &&IX4_SRA_IX_, &&IX4_SRA_IX_with_LD_A,
+            &&IX4_SLL_IX_with_LD_B, &&IX4_SLL_IX_with_LD_C, &&IX4_SLL_IX_with_LD_D, &&IX4_SLL_IX_with_LD_E, &&IX4_SLL_IX_with_LD_H, &&IX4_SLL_IX_with_LD_L, &&IX4_SLL_IX_, &&IX4_SLL_IX_with_LD_A,
+            &&IX4_SRL_IX_with_LD_B, &&IX4_SRL_IX_with_LD_C, &&IX4_SRL_IX_with_LD_D, &&IX4_SRL_IX_with_LD_E, &&IX4_SRL_IX_with_LD_H, &&IX4_SRL_IX_with_LD_L, &&IX4_SRL_IX_, &&IX4_SRL_IX_with_LD_A,
+            &&IX4_BIT_IX_0, &&IX4_BIT_IX_0, &&IX4_BIT_IX_0, &&IX4_BIT_IX_0, &&IX4_BIT_IX_0, &&IX4_BIT_IX_0, &&IX4_BIT_IX_0, &&IX4_BIT_IX_0,
+            &&IX4_BIT_IX_1, &&IX4_BIT_IX_1, &&IX4_BIT_IX_1, &&IX4_BIT_IX_1, &&IX4_BIT_IX_1, &&IX4_BIT_IX_1, &&IX4_BIT_IX_1, &&IX4_BIT_IX_1,
+            &&IX4_BIT_IX_2, &&IX4_BIT_IX_2, &&IX4_BIT_IX_2, &&IX4_BIT_IX_2, &&IX4_BIT_IX_2, &&IX4_BIT_IX_2, &&IX4_BIT_IX_2, &&IX4_BIT_IX_2,
+            &&IX4_BIT_IX_3, &&IX4_BIT_IX_3, &&IX4_BIT_IX_3, &&IX4_BIT_IX_3, &&IX4_BIT_IX_3, &&IX4_BIT_IX_3, &&IX4_BIT_IX_3, &&IX4_BIT_IX_3,
+            &&IX4_BIT_IX_4, &&IX4_BIT_IX_4, &&IX4_BIT_IX_4, &&IX4_BIT_IX_4, &&IX4_BIT_IX_4, &&IX4_BIT_IX_4, &&IX4_BIT_IX_4, &&IX4_BIT_IX_4,
+            &&IX4_BIT_IX_5, &&IX4_BIT_IX_5, &&IX4_BIT_IX_5, &&IX4_BIT_IX_5, &&IX4_BIT_IX_5, &&IX4_BIT_IX_5, &&IX4_BIT_IX_5, &&IX4_BIT_IX_5,
+            &&IX4_BIT_IX_6, &&IX4_BIT_IX_6, &&IX4_BIT_IX_6, &&IX4_BIT_IX_6, &&IX4_BIT_IX_6, &&IX4_BIT_IX_6, &&IX4_BIT_IX_6, &&IX4_BIT_IX_6,
+            &&IX4_BIT_IX_7, &&IX4_BIT_IX_7, &&IX4_BIT_IX_7, &&IX4_BIT_IX_7, &&IX4_BIT_IX_7, &&IX4_BIT_IX_7, &&IX4_BIT_IX_7, &&IX4_BIT_IX_7,
+            &&IX4_RES_IX_0_with_LD_B, &&IX4_RES_IX_0_with_LD_C, &&IX4_RES_IX_0_with_LD_D, &&IX4_RES_IX_0_with_LD_E, &&IX4_RES_IX_0_with_LD_H, &&IX4_RES_IX_0_with_LD_L, &&IX4_RES_IX_0, &&IX4_RES_IX_0_with_LD_A,
+            &&IX4_RES_IX_1_with_LD_B, &&IX4_RES_IX_1_with_LD_C, &&IX4_RES_IX_1_with_LD_D, &&IX4_RES_IX_1_with_LD_E, &&IX4_RES_IX_1_with_LD_H, &&IX4_RES_IX_1_with_LD_L, &&IX4_RES_IX_1, &&IX4_RES_IX_1_with_LD_A,
+            &&IX4_RES_IX_2_with_LD_B, &&IX4_RES_IX_2_with_LD_C, &&IX4_RES_IX_2_with_LD_D, &&IX4_RES_IX_2_with_LD_E, &&IX4_RES_IX_2_with_LD_H, &&IX4_RES_IX_2_with_LD_L, &&IX4_RES_IX_2, &&IX4_RES_IX_2_with_LD_A,
+            &&IX4_RES_IX_3_with_LD_B, &&IX4_RES_IX_3_with_LD_C, &&IX4_RES_IX_3_with_LD_D, &&IX4_RES_IX_3_with_LD_E, &&IX4_RES_IX_3_with_LD_H, &&IX4_RES_IX_3_with_LD_L, &&IX4_RES_IX_3, &&IX4_RES_IX_3_with_LD_A,
+            &&IX4_RES_IX_4_with_LD_B, &&IX4_RES_IX_4_with_LD_C, &&IX4_RES_IX_4_with_LD_D, &&IX4_RES_IX_4_with_LD_E, &&IX4_RES_IX_4_with_LD_H, &&IX4_RES_IX_4_with_LD_L, &&IX4_RES_IX_4, &&IX4_RES_IX_4_with_LD_A,
+            &&IX4_RES_IX_5_with_LD_B, &&IX4_RES_IX_5_with_LD_C, &&IX4_RES_IX_5_with_LD_D, &&IX4_RES_IX_5_with_LD_E, &&IX4_RES_IX_5_with_LD_H, &&IX4_RES_IX_5_with_LD_L, &&IX4_RES_IX_5, &&IX4_RES_IX_5_with_LD_A,
+            &&IX4_RES_IX_6_with_LD_B, &&IX4_RES_IX_6_with_LD_C, &&IX4_RES_IX_6_with_LD_D, &&IX4_RES_IX_6_with_LD_E, &&IX4_RES_IX_6_with_LD_H, &&IX4_RES_IX_6_with_LD_L, &&IX4_RES_IX_6, &&IX4_RES_IX_6_with_LD_A,
+            &&IX4_RES_IX_7_with_LD_B, &&IX4_RES_IX_7_with_LD_C, &&IX4_RES_IX_7_with_LD_D, &&IX4_RES_IX_7_with_LD_E, &&IX4_RES_IX_7_with_LD_H, &&IX4_RES_IX_7_with_LD_L, &&IX4_RES_IX_7, &&IX4_RES_IX_7_with_LD_A,
+            &&IX4_SET_IX_0_with_LD_B, &&IX4_SET_IX_0_with_LD_C, &&IX4_SET_IX_0_with_LD_D, &&IX4_SET_IX_0_with_LD_E, &&IX4_SET_IX_0_with_LD_H, &&IX4_SET_IX_0_with_LD_L, &&IX4_SET_IX_0, &&IX4_SET_IX_0_with_LD_A,
+            &&IX4_SET_IX_1_with_LD_B, &&IX4_SET_IX_1_with_LD_C, &&IX4_SET_IX_1_with_LD_D, &&IX4_SET_IX_1_with_LD_E, &&IX4_SET_IX_1_with_LD_H, &&IX4_SET_IX_1_with_LD_L, &&IX4_SET_IX_1, &&IX4_SET_IX_1_with_LD_A,
+            &&IX4_SET_IX_2_with_LD_B, &&IX4_SET_IX_2_with_LD_C, &&IX4_SET_IX_2_with_LD_D, &&IX4_SET_IX_2_with_LD_E, &&IX4_SET_IX_2_with_LD_H, &&IX4_SET_IX_2_with_LD_L, &&IX4_SET_IX_2, &&IX4_SET_IX_2_with_LD_A,
+            &&IX4_SET_IX_3_with_LD_B, &&IX4_SET_IX_3_with_LD_C, &&IX4_SET_IX_3_with_LD_D, &&IX4_SET_IX_3_with_LD_E, &&IX4_SET_IX_3_with_LD_H, &&IX4_SET_IX_3_with_LD_L, &&IX4_SET_IX_3, &&IX4_SET_IX_3_with_LD_A,
+            &&IX4_SET_IX_4_with_LD_B, &&IX4_SET_IX_4_with_LD_C, &&IX4_SET_IX_4_with_LD_D, &&IX4_SET_IX_4_with_LD_E, &&IX4_SET_IX_4_with_LD_H, &&IX4_SET_IX_4_with_LD_L, &&IX4_SET_IX_4, &&IX4_SET_IX_4_with_LD_A,
+            &&IX4_SET_IX_5_with_LD_B, &&IX4_SET_IX_5_with_LD_C, &&IX4_SET_IX_5_with_LD_D, &&IX4_SET_IX_5_with_LD_E, &&IX4_SET_IX_5_with_LD_H, &&IX4_SET_IX_5_with_LD_L, &&IX4_SET_IX_5, &&IX4_SET_IX_5_with_LD_A,
+            &&IX4_SET_IX_6_with_LD_B, &&IX4_SET_IX_6_with_LD_C, &&IX4_SET_IX_6_with_LD_D, &&IX4_SET_IX_6_with_LD_E, &&IX4_SET_IX_6_with_LD_H, &&IX4_SET_IX_6_with_LD_L, &&IX4_SET_IX_6, &&IX4_SET_IX_6_with_LD_A,
+            &&IX4_SET_IX_7_with_LD_B, &&IX4_SET_IX_7_with_LD_C, &&IX4_SET_IX_7_with_LD_D, &&IX4_SET_IX_7_with_LD_E, &&IX4_SET_IX_7_with_LD_H, &&IX4_SET_IX_7_with_LD_L, &&IX4_SET_IX_7, &&IX4_SET_IX_7_with_LD_A};
+        static const void* const labelIY4[256] = {
+            &&IY4_RLC_IY_with_LD_B, &&IY4_RLC_IY_with_LD_C, &&IY4_RLC_IY_with_LD_D, &&IY4_RLC_IY_with_LD_E, &&IY4_RLC_IY_with_LD_H, &&IY4_RLC_IY_with_LD_L, &&IY4_RLC_IY_, &&IY4_RLC_IY_with_LD_A,
+            &&IY4_RRC_IY_with_LD_B, &&IY4_RRC_IY_with_LD_C, &&IY4_RRC_IY_with_LD_D, &&IY4_RRC_IY_with_LD_E, &&IY4_RRC_IY_with_LD_H, &&IY4_RRC_IY_with_LD_L, &&IY4_RRC_IY_, &&IY4_RRC_IY_with_LD_A,
+            &&IY4_RL_IY_with_LD_B, &&IY4_RL_IY_with_LD_C, &&IY4_RL_IY_with_LD_D, &&IY4_RL_IY_with_LD_E, &&IY4_RL_IY_with_LD_H, &&IY4_RL_IY_with_LD_L, &&IY4_RL_IY_, &&IY4_RL_IY_with_LD_A,
+            &&IY4_RR_IY_with_LD_B, &&IY4_RR_IY_with_LD_C, &&IY4_RR_IY_with_LD_D, &&IY4_RR_IY_with_LD_E, &&IY4_RR_IY_with_LD_H, &&IY4_RR_IY_with_LD_L, &&IY4_RR_IY_, &&IY4_RR_IY_with_LD_A,
+            &&IY4_SLA_IY_with_LD_B, &&IY4_SLA_IY_with_LD_C, &&IY4_SLA_IY_with_LD_D, &&IY4_SLA_IY_with_LD_E, &&IY4_SLA_IY_with_LD_H, &&IY4_SLA_IY_with_LD_L, &&IY4_SLA_IY_, &&IY4_SLA_IY_with_LD_A,
+            &&IY4_SRA_IY_with_LD_B, &&IY4_SRA_IY_with_LD_C, &&IY4_SRA_IY_with_LD_D, &&IY4_SRA_IY_with_LD_E, &&IY4_SRA_IY_with_LD_H, &&IY4_SRA_IY_with_LD_L, &&IY4_SRA_IY_, &&IY4_SRA_IY_with_LD_A,
+            &&IY4_SLL_IY_with_LD_B, &&IY4_SLL_IY_with_LD_C, &&IY4_SLL_IY_with_LD_D, &&IY4_SLL_IY_with_LD_E, &&IY4_SLL_IY_with_LD_H, &&IY4_SLL_IY_with_LD_L, &&IY4_SLL_IY_, &&IY4_SLL_IY_with_LD_A,
+            &&IY4_SRL_IY_with_LD_B, &&IY4_SRL_IY_with_LD_C, &&IY4_SRL_IY_with_LD_D, &&IY4_SRL_IY_with_LD_E, &&IY4_SRL_IY_with_LD_H, &&IY4_SRL_IY_with_LD_L, &&IY4_SRL_IY_, &&IY4_SRL_IY_with_LD_A,
+            &&IY4_BIT_IY_0, &&IY4_BIT_IY_0, &&IY4_BIT_IY_0, &&IY4_BIT_IY_0, &&IY4_BIT_IY_0, &&IY4_BIT_IY_0, &&IY4_BIT_IY_0, &&IY4_BIT_IY_0,
+            &&IY4_BIT_IY_1, &&IY4_BIT_IY_1, &&IY4_BIT_IY_1, &&IY4_BIT_IY_1, &&IY4_BIT_IY_1, &&IY4_BIT_IY_1, &&IY4_BIT_IY_1, &&IY4_BIT_IY_1,
+            &&IY4_BIT_IY_2, &&IY4_BIT_IY_2, &&IY4_BIT_IY_2, &&IY4_BIT_IY_2, &&IY4_BIT_IY_2, &&IY4_BIT_IY_2, &&IY4_BIT_IY_2, &&IY4_BIT_IY_2,
+            &&IY4_BIT_IY_3, &&IY4_BIT_IY_3, &&IY4_BIT_IY_3, &&IY4_BIT_IY_3, &&IY4_BIT_IY_3, &&IY4_BIT_IY_3, &&IY4_BIT_IY_3, &&IY4_BIT_IY_3,
+            &&IY4_BIT_IY_4, &&IY4_BIT_IY_4, &&IY4_BIT_IY_4, &&IY4_BIT_IY_4, &&IY4_BIT_IY_4, &&IY4_BIT_IY_4, &&IY4_BIT_IY_4, &&IY4_BIT_IY_4,
+            &&IY4_BIT_IY_5, &&IY4_BIT_IY_5, &&IY4_BIT_IY_5, &&IY4_BIT_IY_5, &&IY4_BIT_IY_5, &&IY4_BIT_IY_5, &&IY4_BIT_IY_5, &&IY4_BIT_IY_5,
+            &&IY4_BIT_IY_6, &&IY4_BIT_IY_6, &&IY4_BIT_IY_6, &&IY4_BIT_IY_6, &&IY4_BIT_IY_6, &&IY4_BIT_IY_6, &&IY4_BIT_IY_6, &&IY4_BIT_IY_6,
+            &&IY4_BIT_IY_7, &&IY4_BIT_IY_7, &&IY4_BIT_IY_7, &&IY4_BIT_IY_7, &&IY4_BIT_IY_7, &&IY4_BIT_IY_7, &&IY4_BIT_IY_7, &&IY4_BIT_IY_7,
+            &&IY4_RES_IY_0_with_LD_B, &&IY4_RES_IY_0_with_LD_C, &&IY4_RES_IY_0_with_LD_D, &&IY4_RES_IY_0_with_LD_E, &&IY4_RES_IY_0_with_LD_H, &&IY4_RES_IY_0_with_LD_L, &&IY4_RES_IY_0, &&IY4_RES_IY_0_with_LD_A,
+            &&IY4_RES_IY_1_with_LD_B, &&IY4_RES_IY_1_with_LD_C, &&IY4_RES_IY_1_with_LD_D, &&IY4_RES_IY_1_with_LD_E, &&IY4_RES_IY_1_with_LD_H, &&IY4_RES_IY_1_with_LD_L, &&IY4_RES_IY_1, &&IY4_RES_IY_1_with_LD_A,
+            &&IY4_RES_IY_2_with_LD_B, &&IY4_RES_IY_2_with_LD_C, &&IY4_RES_IY_2_with_LD_D, &&IY4_RES_IY_2_with_LD_E, &&IY4_RES_IY_2_with_LD_H, &&IY4_RES_IY_2_with_LD_L, &&IY4_RES_IY_2, &&IY4_RES_IY_2_with_LD_A,
+            &&IY4_RES_IY_3_with_LD_B, &&IY4_RES_IY_3_with_LD_C, &&IY4_RES_IY_3_with_LD_D, &&IY4_RES_IY_3_with_LD_E, &&IY4_RES_IY_3_with_LD_H, &&IY4_RES_IY_3_with_LD_L, &&IY4_RES_IY_3, &&IY4_RES_IY_3_with_LD_A,
+            &&IY4_RES_IY_4_with_LD_B, &&IY4_RES_IY_4_with_LD_C, &&IY4_RES_IY_4_with_LD_D, &&IY4_RES_IY_4_with_LD_E, &&IY4_RES_IY_4_with_LD_H, &&IY4_RES_IY_4_with_LD_L, &&IY4_RES_IY_4, &&IY4_RES_IY_4_with_LD_A,
+            &&IY4_RES_IY_5_with_LD_B, &&IY4_RES_IY_5_with_LD_C, &&IY4_RES_IY_5_with_LD_D, &&IY4_RES_IY_5_with_LD_E, &&IY4_RES_IY_5_with_LD_H, &&IY4_RES_IY_5_with_LD_L, &&IY4_RES_IY_5, &&IY4_RES_IY_5_with_LD_A,
+            &&IY4_RES_IY_6_with_LD_B, &&IY4_RES_IY_6_with_LD_C, &&IY4_RES_IY_6_with_LD_D, &&IY4_RES_IY_6_with_LD_E, &&IY4_RES_IY_6_with_LD_H, &&IY4_RES_IY_6_with_LD_L, &&IY4_RES_IY_6, &&IY4_RES_IY_6_with_LD_A,
+            &&IY4_RES_IY_7_with_LD_B, &&IY4_RES_IY_7_with_LD_C, &&IY4_RES_IY_7_with_LD_D, &&IY4_RES_IY_7_with_LD_E, &&IY4_RES_IY_7_with_LD_H, &&IY4_RES_IY_7_with_LD_L, &&IY4_RES_IY_7, &&IY4_RES_IY_7_with_LD_A,
+            &&IY4_SET_IY_0_with_LD_B, &&IY4_SET_IY_0_with_LD_C, &&IY4_SET_IY_0_with_LD_D, &&IY4_SET_IY_0_with_LD_E, &&IY4_SET_IY_0_with_LD_H, &&IY4_SET_IY_0_with_LD_L, &&IY4_SET_IY_0, &&IY4_SET_IY_0_with_LD_A,
+            &&IY4_SET_IY_1_with_LD_B, &&IY4_SET_IY_1_with_LD_C, &&IY4_SET_IY_1_with_LD_D, &&IY4_SET_IY_1_with_LD_E, &&IY4_SET_IY_1_with_LD_H, &&IY4_SET_IY_1_with_LD_L, &&IY4_SET_IY_1, &&IY4_SET_IY_1_with_LD_A,
+            &&IY4_SET_IY_2_with_LD_B, &&IY4_SET_IY_2_with_LD_C, &&IY4_SET_IY_2_with_LD_D, &&IY4_SET_IY_2_with_LD_E, &&IY4_SET_IY_2_with_LD_H, &&IY4_SET_IY_2_with_LD_L, &&IY4_SET_IY_2, &&IY4_SET_IY_2_with_LD_A,
+            &&IY4_SET_IY_3_with_LD_B, &&IY4_SET_IY_3_with_LD_C, &&IY4_SET_IY_3_with_LD_D, &&IY4_SET_IY_3_with_LD_E, &&IY4_SET_IY_3_with_LD_H, &&IY4_SET_IY_3_with_LD_L, &&IY4_SET_IY_3, &&IY4_SET_IY_3_with_LD_A,
+            &&IY4_SET_IY_4_with_LD_B, &&IY4_SET_IY_4_with_LD_C, &&IY4_SET_IY_4_with_LD_D, &&IY4_SET_IY_4_with_LD_E, &&IY4_SET_IY_4_with_LD_H, &&IY4_SET_IY_4_with_LD_L, &&IY4_SET_IY_4, &&IY4_SET_IY_4_with_LD_A,
+            &&IY4_SET_IY_5_with_LD_B, &&IY4_SET_IY_5_with_LD_C, &&IY4_SET_IY_5_with_LD_D, &&IY4_SET_IY_5_with_LD_E, &&IY4_SET_IY_5_with_LD_H, &&IY4_SET_IY_5_with_LD_L, &&IY4_SET_IY_5, &&IY4_SET_IY_5_with_LD_A,
+            &&IY4_SET_IY_6_with_LD_B, &&IY4_SET_IY_6_with_LD_C, &&IY4_SET_IY_6_with_LD_D, &&IY4_SET_IY_6_with_LD_E, &&IY4_SET_IY_6_with_LD_H, &&IY4_SET_IY_6_with_LD_L, &&IY4_SET_IY_6, &&IY4_SET_IY_6_with_LD_A,
+            &&IY4_SET_IY_7_with_LD_B, &&IY4_SET_IY_7_with_LD_C, &&IY4_SET_IY_7_with_LD_D, &&IY4_SET_IY_7_with_LD_E, &&IY4_SET_IY_7_with_LD_H, &&IY4_SET_IY_7_with_LD_L, &&IY4_SET_IY_7, &&IY4_SET_IY_7_with_LD_A};
+        int executed = 0;
+        unsigned char operandNumber;
+        signed char d;
+        requestBreakFlag = false;
+        reg.consumeClockCounter = 0;
+        if (clock <= 0) return 0;
+        Z80_THREADED_DISPATCH_NEXT();
+    HALTED:
+        // execute NOP while halt
+        reg.execEI = 0;
+        readByte(reg.PC); // NOTE: read and discard (to be consumed 4Hz)
+        Z80_THREADED_NEXT();
+    OP1_NOP:
+        NOP(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_BC_NN:
+        LD_BC_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_BC_A:
+        LD_BC_A(this);
+        Z80_THREADED_NEXT();
+    OP1_INC_RP_BC:
+        INC_RP_BC(this);
+        Z80_THREADED_NEXT();
+    OP1_INC_B:
+        INC_B(this);
+        Z80_THREADED_NEXT();
+    OP1_DEC_B:
+        DEC_B(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_B_N:
+        LD_B_N(this);
+        Z80_THREADED_NEXT();
+    OP1_RLCA:
+        RLCA(this);
+        Z80_THREADED_NEXT();
+    OP1_EX_AF_AF2:
+        EX_AF_AF2(this);
+        Z80_THREADED_NEXT();
+    OP1_ADD_HL_BC:
+        ADD_HL_BC(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_A_BC:
+        LD_A_BC(this);
+        Z80_THREADED_NEXT();
+    OP1_DEC_RP_BC:
+        DEC_RP_BC(this);
+        Z80_THREADED_NEXT();
+    OP1_INC_C:
+        INC_C(this);
+        Z80_THREADED_NEXT();
+    OP1_DEC_C:
+        DEC_C(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_C_N:
+        LD_C_N(this);
+        Z80_THREADED_NEXT();
+    OP1_RRCA:
+        RRCA(this);
+        Z80_THREADED_NEXT();
+    OP1_DJNZ_E:
+        DJNZ_E(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_DE_NN:
+        LD_DE_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_DE_A:
+        LD_DE_A(this);
+        Z80_THREADED_NEXT();
+    OP1_INC_RP_DE:
+        INC_RP_DE(this);
+        Z80_THREADED_NEXT();
+    OP1_INC_D:
+        INC_D(this);
+        Z80_THREADED_NEXT();
+    OP1_DEC_D:
+        DEC_D(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_D_N:
+        LD_D_N(this);
+        Z80_THREADED_NEXT();
+    OP1_RLA:
+        RLA(this);
+        Z80_THREADED_NEXT();
+    OP1_JR_E:
+        JR_E(this);
+        Z80_THREADED_NEXT();
+    OP1_ADD_HL_DE:
+        ADD_HL_DE(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_A_DE:
+        LD_A_DE(this);
+        Z80_THREADED_NEXT();
+    OP1_DEC_RP_DE:
+        DEC_RP_DE(this);
+        Z80_THREADED_NEXT();
+    OP1_INC_E:
+        INC_E(this);
+        Z80_THREADED_NEXT();
+    OP1_DEC_E:
+        DEC_E(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_E_N:
+        LD_E_N(this);
+        Z80_THREADED_NEXT();
+    OP1_RRA:
+        RRA(this);
+        Z80_THREADED_NEXT();
+    OP1_JR_NZ_E:
+        JR_NZ_E(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_HL_NN:
+        LD_HL_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_ADDR_HL:
+        LD_ADDR_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_INC_RP_HL:
+        INC_RP_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_INC_H:
+        INC_H(this);
+        Z80_THREADED_NEXT();
+    OP1_DEC_H:
+        DEC_H(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_H_N:
+        LD_H_N(this);
+        Z80_THREADED_NEXT();
+    OP1_DAA:
+        DAA(this);
+        Z80_THREADED_NEXT();
+    OP1_JR_Z_E:
+        JR_Z_E(this);
+        Z80_THREADED_NEXT();
+    OP1_ADD_HL_HL:
+        ADD_HL_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_HL_ADDR:
+        LD_HL_ADDR(this);
+        Z80_THREADED_NEXT();
+    OP1_DEC_RP_HL:
+        DEC_RP_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_INC_L:
+        INC_L(this);
+        Z80_THREADED_NEXT();
+    OP1_DEC_L:
+        DEC_L(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_L_N:
+        LD_L_N(this);
+        Z80_THREADED_NEXT();
+    OP1_CPL:
+        CPL(this);
+        Z80_THREADED_NEXT();
+    OP1_JR_NC_E:
+        JR_NC_E(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_SP_NN:
+        LD_SP_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_NN_A:
+        LD_NN_A(this);
+        Z80_THREADED_NEXT();
+    OP1_INC_RP_SP:
+        INC_RP_SP(this);
+        Z80_THREADED_NEXT();
+    OP1_INC_HL:
+        INC_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_DEC_HL:
+        DEC_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_HL_N:
+        LD_HL_N(this);
+        Z80_THREADED_NEXT();
+    OP1_SCF:
+        SCF(this);
+        Z80_THREADED_NEXT();
+    OP1_JR_C_E:
+        JR_C_E(this);
+        Z80_THREADED_NEXT();
+    OP1_ADD_HL_SP:
+        ADD_HL_SP(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_A_NN:
+        LD_A_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_DEC_RP_SP:
+        DEC_RP_SP(this);
+        Z80_THREADED_NEXT();
+    OP1_INC_A:
+        INC_A(this);
+        Z80_THREADED_NEXT();
+    OP1_DEC_A:
+        DEC_A(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_A_N:
+        LD_A_N(this);
+        Z80_THREADED_NEXT();
+    OP1_CCF:
+        CCF(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_B_B:
+        LD_B_B(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_B_C:
+        LD_B_C(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_B_D:
+        LD_B_D(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_B_E:
+        LD_B_E(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_B_H:
+        LD_B_H(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_B_L:
+        LD_B_L(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_B_HL:
+        LD_B_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_B_A:
+        LD_B_A(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_C_B:
+        LD_C_B(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_C_C:
+        LD_C_C(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_C_D:
+        LD_C_D(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_C_E:
+        LD_C_E(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_C_H:
+        LD_C_H(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_C_L:
+        LD_C_L(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_C_HL:
+        LD_C_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_C_A:
+        LD_C_A(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_D_B:
+        LD_D_B(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_D_C:
+        LD_D_C(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_D_D:
+        LD_D_D(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_D_E:
+        LD_D_E(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_D_H:
+        LD_D_H(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_D_L:
+        LD_D_L(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_D_HL:
+        LD_D_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_D_A:
+        LD_D_A(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_E_B:
+        LD_E_B(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_E_C:
+        LD_E_C(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_E_D:
+        LD_E_D(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_E_E:
+        LD_E_E(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_E_H:
+        LD_E_H(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_E_L:
+        LD_E_L(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_E_HL:
+        LD_E_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_E_A:
+        LD_E_A(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_H_B:
+        LD_H_B(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_H_C:
+        LD_H_C(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_H_D:
+        LD_H_D(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_H_E:
+        LD_H_E(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_H_H:
+        LD_H_H(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_H_L:
+        LD_H_L(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_H_HL:
+        LD_H_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_H_A:
+        LD_H_A(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_L_B:
+        LD_L_B(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_L_C:
+        LD_L_C(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_L_D:
+        LD_L_D(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_L_E:
+        LD_L_E(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_L_H:
+        LD_L_H(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_L_L:
+        LD_L_L(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_L_HL:
+        LD_L_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_L_A:
+        LD_L_A(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_HL_B:
+        LD_HL_B(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_HL_C:
+        LD_HL_C(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_HL_D:
+        LD_HL_D(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_HL_E:
+        LD_HL_E(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_HL_H:
+        LD_HL_H(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_HL_L:
+        LD_HL_L(this);
+        Z80_THREADED_NEXT();
+    OP1_HALT:
+        HALT(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_HL_A:
+        LD_HL_A(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_A_B:
+        LD_A_B(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_A_C:
+        LD_A_C(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_A_D:
+        LD_A_D(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_A_E:
+        LD_A_E(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_A_H:
+        LD_A_H(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_A_L:
+        LD_A_L(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_A_HL:
+        LD_A_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_A_A:
+        LD_A_A(this);
+        Z80_THREADED_NEXT();
+    OP1_ADD_B:
+        ADD_B(this);
+        Z80_THREADED_NEXT();
+    OP1_ADD_C:
+        ADD_C(this);
+        Z80_THREADED_NEXT();
+    OP1_ADD_D:
+        ADD_D(this);
+        Z80_THREADED_NEXT();
+    OP1_ADD_E:
+        ADD_E(this);
+        Z80_THREADED_NEXT();
+    OP1_ADD_H:
+        ADD_H(this);
+        Z80_THREADED_NEXT();
+    OP1_ADD_L:
+        ADD_L(this);
+        Z80_THREADED_NEXT();
+    OP1_ADD_HL:
+        ADD_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_ADD_A:
+        ADD_A(this);
+        Z80_THREADED_NEXT();
+    OP1_ADC_B:
+        ADC_B(this);
+        Z80_THREADED_NEXT();
+    OP1_ADC_C:
+        ADC_C(this);
+        Z80_THREADED_NEXT();
+    OP1_ADC_D:
+        ADC_D(this);
+        Z80_THREADED_NEXT();
+    OP1_ADC_E:
+        ADC_E(this);
+        Z80_THREADED_NEXT();
+    OP1_ADC_H:
+        ADC_H(this);
+        Z80_THREADED_NEXT();
+    OP1_ADC_L:
+        ADC_L(this);
+        Z80_THREADED_NEXT();
+    OP1_ADC_HL:
+        ADC_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_ADC_A:
+        ADC_A(this);
+        Z80_THREADED_NEXT();
+    OP1_SUB_B:
+        SUB_B(this);
+        Z80_THREADED_NEXT();
+    OP1_SUB_C:
+        SUB_C(this);
+        Z80_THREADED_NEXT();
+    OP1_SUB_D:
+        SUB_D(this);
+        Z80_THREADED_NEXT();
+    OP1_SUB_E:
+        SUB_E(this);
+        Z80_THREADED_NEXT();
+    OP1_SUB_H:
+        SUB_H(this);
+        Z80_THREADED_NEXT();
+    OP1_SUB_L:
+        SUB_L(this);
+        Z80_THREADED_NEXT();
+    OP1_SUB_HL:
+        SUB_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_SUB_A:
+        SUB_A(this);
+        Z80_THREADED_NEXT();
+    OP1_SBC_B:
+        SBC_B(this);
+        Z80_THREADED_NEXT();
+    OP1_SBC_C:
+        SBC_C(this);
+        Z80_THREADED_NEXT();
+    OP1_SBC_D:
+        SBC_D(this);
+        Z80_THREADED_NEXT();
+    OP1_SBC_E:
+        SBC_E(this);
+        Z80_THREADED_NEXT();
+    OP1_SBC_H:
+        SBC_H(this);
+        Z80_THREADED_NEXT();
+    OP1_SBC_L:
+        SBC_L(this);
+        Z80_THREADED_NEXT();
+    OP1_SBC_HL:
+        SBC_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_SBC_A:
+        SBC_A(this);
+        Z80_THREADED_NEXT();
+    OP1_AND_B:
+        AND_B(this);
+        Z80_THREADED_NEXT();
+    OP1_AND_C:
+        AND_C(this);
+        Z80_THREADED_NEXT();
+    OP1_AND_D:
+        AND_D(this);
+        Z80_THREADED_NEXT();
+    OP1_AND_E:
+        AND_E(this);
+        Z80_THREADED_NEXT();
+    OP1_AND_H:
+        AND_H(this);
+        Z80_THREADED_NEXT();
+    OP1_AND_L:
+        AND_L(this);
+        Z80_THREADED_NEXT();
+    OP1_AND_HL:
+        AND_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_AND_A:
+        AND_A(this);
+        Z80_THREADED_NEXT();
+    OP1_XOR_B:
+        XOR_B(this);
+        Z80_THREADED_NEXT();
+    OP1_XOR_C:
+        XOR_C(this);
+        Z80_THREADED_NEXT();
+    OP1_XOR_D:
+        XOR_D(this);
+        Z80_THREADED_NEXT();
+    OP1_XOR_E:
+        XOR_E(this);
+        Z80_THREADED_NEXT();
+    OP1_XOR_H:
+        XOR_H(this);
+        Z80_THREADED_NEXT();
+    OP1_XOR_L:
+        XOR_L(this);
+        Z80_THREADED_NEXT();
+    OP1_XOR_HL:
+        XOR_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_XOR_A:
+        XOR_A(this);
+        Z80_THREADED_NEXT();
+    OP1_OR_B:
+        OR_B(this);
+        Z80_THREADED_NEXT();
+    OP1_OR_C:
+        OR_C(this);
+        Z80_THREADED_NEXT();
+    OP1_OR_D:
+        OR_D(this);
+        Z80_THREADED_NEXT();
+    OP1_OR_E:
+        OR_E(this);
+        Z80_THREADED_NEXT();
+    OP1_OR_H:
+        OR_H(this);
+        Z80_THREADED_NEXT();
+    OP1_OR_L:
+        OR_L(this);
+        Z80_THREADED_NEXT();
+    OP1_OR_HL:
+        OR_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_OR_A:
+        OR_A(this);
+        Z80_THREADED_NEXT();
+    OP1_CP_B:
+        CP_B(this);
+        Z80_THREADED_NEXT();
+    OP1_CP_C:
+        CP_C(this);
+        Z80_THREADED_NEXT();
+    OP1_CP_D:
+        CP_D(this);
+        Z80_THREADED_NEXT();
+    OP1_CP_E:
+        CP_E(this);
+        Z80_THREADED_NEXT();
+    OP1_CP_H:
+        CP_H(this);
+        Z80_THREADED_NEXT();
+    OP1_CP_L:
+        CP_L(this);
+        Z80_THREADED_NEXT();
+    OP1_CP_HL:
+        CP_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_CP_A:
+        CP_A(this);
+        Z80_THREADED_NEXT();
+    OP1_RET_C0:
+        RET_C0(this);
+        Z80_THREADED_NEXT();
+    OP1_POP_BC:
+        POP_BC(this);
+        Z80_THREADED_NEXT();
+    OP1_JP_C0_NN:
+        JP_C0_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_JP_NN:
+        JP_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_CALL_C0_NN:
+        CALL_C0_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_PUSH_BC:
+        PUSH_BC(this);
+        Z80_THREADED_NEXT();
+    OP1_ADD_N:
+        ADD_N(this);
+        Z80_THREADED_NEXT();
+    OP1_RST00:
+        RST00(this);
+        Z80_THREADED_NEXT();
+    OP1_RET_C1:
+        RET_C1(this);
+        Z80_THREADED_NEXT();
+    OP1_RET:
+        RET(this);
+        Z80_THREADED_NEXT();
+    OP1_JP_C1_NN:
+        JP_C1_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_OP_CB:
+        operandNumber = fetch(4 + wtc.fetchM);
+        goto* labelCB[operandNumber];
+    OP1_CALL_C1_NN:
+        CALL_C1_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_CALL_NN:
+        CALL_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_ADC_N:
+        ADC_N(this);
+        Z80_THREADED_NEXT();
+    OP1_RST08:
+        RST08(this);
+        Z80_THREADED_NEXT();
+    OP1_RET_C2:
+        RET_C2(this);
+        Z80_THREADED_NEXT();
+    OP1_POP_DE:
+        POP_DE(this);
+        Z80_THREADED_NEXT();
+    OP1_JP_C2_NN:
+        JP_C2_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_OUT_N_A:
+        OUT_N_A(this);
+        Z80_THREADED_NEXT();
+    OP1_CALL_C2_NN:
+        CALL_C2_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_PUSH_DE:
+        PUSH_DE(this);
+        Z80_THREADED_NEXT();
+    OP1_SUB_N:
+        SUB_N(this);
+        Z80_THREADED_NEXT();
+    OP1_RST10:
+        RST10(this);
+        Z80_THREADED_NEXT();
+    OP1_RET_C3:
+        RET_C3(this);
+        Z80_THREADED_NEXT();
+    OP1_EXX:
+        EXX(this);
+        Z80_THREADED_NEXT();
+    OP1_JP_C3_NN:
+        JP_C3_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_IN_A_N:
+        IN_A_N(this);
+        Z80_THREADED_NEXT();
+    OP1_CALL_C3_NN:
+        CALL_C3_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_OP_IX:
+        operandNumber = fetch(4 + wtc.fetchM);
+        goto* labelIX[operandNumber];
+    OP1_SBC_N:
+        SBC_N(this);
+        Z80_THREADED_NEXT();
+    OP1_RST18:
+        RST18(this);
+        Z80_THREADED_NEXT();
+    OP1_RET_C4:
+        RET_C4(this);
+        Z80_THREADED_NEXT();
+    OP1_POP_HL:
+        POP_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_JP_C4_NN:
+        JP_C4_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_EX_SP_HL:
+        EX_SP_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_CALL_C4_NN:
+        CALL_C4_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_PUSH_HL:
+        PUSH_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_AND_N:
+        AND_N(this);
+        Z80_THREADED_NEXT();
+    OP1_RST20:
+        RST20(this);
+        Z80_THREADED_NEXT();
+    OP1_RET_C5:
+        RET_C5(this);
+        Z80_THREADED_NEXT();
+    OP1_JP_HL:
+        JP_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_JP_C5_NN:
+        JP_C5_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_EX_DE_HL:
+        EX_DE_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_CALL_C5_NN:
+        CALL_C5_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_OP_ED:
+        operandNumber = fetch(4 + wtc.fetchM);
+        goto* labelED[operandNumber];
+    OP1_XOR_N:
+        XOR_N(this);
+        Z80_THREADED_NEXT();
+    OP1_RST28:
+        RST28(this);
+        Z80_THREADED_NEXT();
+    OP1_RET_C6:
+        RET_C6(this);
+        Z80_THREADED_NEXT();
+    OP1_POP_AF:
+        POP_AF(this);
+        Z80_THREADED_NEXT();
+    OP1_JP_C6_NN:
+        JP_C6_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_DI:
+        DI(this);
+        Z80_THREADED_NEXT();
+    OP1_CALL_C6_NN:
+        CALL_C6_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_PUSH_AF:
+        PUSH_AF(this);
+        Z80_THREADED_NEXT();
+    OP1_OR_N:
+        OR_N(this);
+        Z80_THREADED_NEXT();
+    OP1_RST30:
+        RST30(this);
+        Z80_THREADED_NEXT();
+    OP1_RET_C7:
+        RET_C7(this);
+        Z80_THREADED_NEXT();
+    OP1_LD_SP_HL:
+        LD_SP_HL(this);
+        Z80_THREADED_NEXT();
+    OP1_JP_C7_NN:
+        JP_C7_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_EI:
+        EI(this);
+        Z80_THREADED_NEXT();
+    OP1_CALL_C7_NN:
+        CALL_C7_NN(this);
+        Z80_THREADED_NEXT();
+    OP1_OP_IY:
+        operandNumber = fetch(4 + wtc.fetchM);
+        goto* labelIY[operandNumber];
+    OP1_CP_N:
+        CP_N(this);
+        Z80_THREADED_NEXT();
+    OP1_RST38:
+        RST38(this);
+        Z80_THREADED_NEXT();
+    CB_RLC_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RLC_B(this);
+        Z80_THREADED_NEXT();
+    CB_RLC_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RLC_C(this);
+        Z80_THREADED_NEXT();
+    CB_RLC_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RLC_D(this);
+        Z80_THREADED_NEXT();
+    CB_RLC_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RLC_E(this);
+        Z80_THREADED_NEXT();
+    CB_RLC_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RLC_H(this);
+        Z80_THREADED_NEXT();
+    CB_RLC_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RLC_L(this);
+        Z80_THREADED_NEXT();
+    CB_RLC_HL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RLC_HL_(this);
+        Z80_THREADED_NEXT();
+    CB_RLC_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RLC_A(this);
+        Z80_THREADED_NEXT();
+    CB_RRC_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RRC_B(this);
+        Z80_THREADED_NEXT();
+    CB_RRC_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RRC_C(this);
+        Z80_THREADED_NEXT();
+    CB_RRC_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RRC_D(this);
+        Z80_THREADED_NEXT();
+    CB_RRC_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RRC_E(this);
+        Z80_THREADED_NEXT();
+    CB_RRC_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RRC_H(this);
+        Z80_THREADED_NEXT();
+    CB_RRC_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RRC_L(this);
+        Z80_THREADED_NEXT();
+    CB_RRC_HL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RRC_HL_(this);
+        Z80_THREADED_NEXT();
+    CB_RRC_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RRC_A(this);
+        Z80_THREADED_NEXT();
+    CB_RL_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RL_B(this);
+        Z80_THREADED_NEXT();
+    CB_RL_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RL_C(this);
+        Z80_THREADED_NEXT();
+    CB_RL_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RL_D(this);
+        Z80_THREADED_NEXT();
+    CB_RL_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RL_E(this);
+        Z80_THREADED_NEXT();
+    CB_RL_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RL_H(this);
+        Z80_THREADED_NEXT();
+    CB_RL_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RL_L(this);
+        Z80_THREADED_NEXT();
+    CB_RL_HL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RL_HL_(this);
+        Z80_THREADED_NEXT();
+    CB_RL_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RL_A(this);
+        Z80_THREADED_NEXT();
+    CB_RR_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RR_B(this);
+        Z80_THREADED_NEXT();
+    CB_RR_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RR_C(this);
+        Z80_THREADED_NEXT();
+    CB_RR_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RR_D(this);
+        Z80_THREADED_NEXT();
+    CB_RR_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RR_E(this);
+        Z80_THREADED_NEXT();
+    CB_RR_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RR_H(this);
+        Z80_THREADED_NEXT();
+    CB_RR_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RR_L(this);
+        Z80_THREADED_NEXT();
+    CB_RR_HL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RR_HL_(this);
+        Z80_THREADED_NEXT();
+    CB_RR_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RR_A(this);
+        Z80_THREADED_NEXT();
+    CB_SLA_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SLA_B(this);
+        Z80_THREADED_NEXT();
+    CB_SLA_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SLA_C(this);
+        Z80_THREADED_NEXT();
+    CB_SLA_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SLA_D(this);
+        Z80_THREADED_NEXT();
+    CB_SLA_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SLA_E(this);
+        Z80_THREADED_NEXT();
+    CB_SLA_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SLA_H(this);
+        Z80_THREADED_NEXT();
+    CB_SLA_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SLA_L(this);
+        Z80_THREADED_NEXT();
+    CB_SLA_HL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SLA_HL_(this);
+        Z80_THREADED_NEXT();
+    CB_SLA_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SLA_A(this);
+        Z80_THREADED_NEXT();
+    CB_SRA_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SRA_B(this);
+        Z80_THREADED_NEXT();
+    CB_SRA_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SRA_C(this);
+        Z80_THREADED_NEXT();
+    CB_SRA_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SRA_D(this);
+        Z80_THREADED_NEXT();
+    CB_SRA_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SRA_E(this);
+        Z80_THREADED_NEXT();
+    CB_SRA_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SRA_H(this);
+        Z80_THREADED_NEXT();
+    CB_SRA_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SRA_L(this);
+        Z80_THREADED_NEXT();
+    CB_SRA_HL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SRA_HL_(this);
+        Z80_THREADED_NEXT();
+    CB_SRA_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SRA_A(this);
+        Z80_THREADED_NEXT();
+    CB_SLL_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SLL_B(this);
+        Z80_THREADED_NEXT();
+    CB_SLL_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SLL_C(this);
+        Z80_THREADED_NEXT();
+    CB_SLL_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SLL_D(this);
+        Z80_THREADED_NEXT();
+    CB_SLL_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SLL_E(this);
+        Z80_THREADED_NEXT();
+    CB_SLL_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SLL_H(this);
+        Z80_THREADED_NEXT();
+    CB_SLL_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SLL_L(this);
+        Z80_THREADED_NEXT();
+    CB_SLL_HL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SLL_HL_(this);
+        Z80_THREADED_NEXT();
+    CB_SLL_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SLL_A(this);
+        Z80_THREADED_NEXT();
+    CB_SRL_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SRL_B(this);
+        Z80_THREADED_NEXT();
+    CB_SRL_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SRL_C(this);
+        Z80_THREADED_NEXT();
+    CB_SRL_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SRL_D(this);
+        Z80_THREADED_NEXT();
+    CB_SRL_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SRL_E(this);
+        Z80_THREADED_NEXT();
+    CB_SRL_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SRL_H(this);
+        Z80_THREADED_NEXT();
+    CB_SRL_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SRL_L(this);
+        Z80_THREADED_NEXT();
+    CB_SRL_HL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SRL_HL_(this);
+        Z80_THREADED_NEXT();
+    CB_SRL_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SRL_A(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_B_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_B_0(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_C_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_C_0(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_D_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_D_0(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_E_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_E_0(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_H_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_H_0(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_L_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_L_0(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_HL_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_HL_0(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_A_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_A_0(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_B_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_B_1(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_C_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_C_1(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_D_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_D_1(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_E_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_E_1(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_H_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_H_1(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_L_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_L_1(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_HL_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_HL_1(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_A_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_A_1(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_B_2(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_C_2(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_D_2(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_E_2(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_H_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_H_2(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_L_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_L_2(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_HL_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_HL_2(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_A_2(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_B_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_B_3(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_C_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_C_3(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_D_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_D_3(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_E_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_E_3(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_H_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_H_3(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_L_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_L_3(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_HL_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_HL_3(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_A_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_A_3(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_B_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_B_4(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_C_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_C_4(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_D_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_D_4(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_E_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_E_4(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_H_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_H_4(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_L_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_L_4(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_HL_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_HL_4(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_A_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_A_4(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_B_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_B_5(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_C_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_C_5(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_D_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_D_5(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_E_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_E_5(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_H_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_H_5(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_L_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_L_5(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_HL_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_HL_5(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_A_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_A_5(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_B_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_B_6(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_C_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_C_6(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_D_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_D_6(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_E_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_E_6(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_H_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_H_6(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_L_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_L_6(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_HL_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_HL_6(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_A_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_A_6(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_B_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_B_7(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_C_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_C_7(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_D_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_D_7(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_E_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_E_7(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_H_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_H_7(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_L_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_L_7(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_HL_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_HL_7(this);
+        Z80_THREADED_NEXT();
+    CB_BIT_A_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        BIT_A_7(this);
+        Z80_THREADED_NEXT();
+    CB_RES_B_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_B_0(this);
+        Z80_THREADED_NEXT();
+    CB_RES_C_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_C_0(this);
+        Z80_THREADED_NEXT();
+    CB_RES_D_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_D_0(this);
+        Z80_THREADED_NEXT();
+    CB_RES_E_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_E_0(this);
+        Z80_THREADED_NEXT();
+    CB_RES_H_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_H_0(this);
+        Z80_THREADED_NEXT();
+    CB_RES_L_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_L_0(this);
+        Z80_THREADED_NEXT();
+    CB_RES_HL_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_HL_0(this);
+        Z80_THREADED_NEXT();
+    CB_RES_A_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_A_0(this);
+        Z80_THREADED_NEXT();
+    CB_RES_B_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_B_1(this);
+        Z80_THREADED_NEXT();
+    CB_RES_C_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_C_1(this);
+        Z80_THREADED_NEXT();
+    CB_RES_D_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_D_1(this);
+        Z80_THREADED_NEXT();
+    CB_RES_E_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_E_1(this);
+        Z80_THREADED_NEXT();
+    CB_RES_H_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_H_1(this);
+        Z80_THREADED_NEXT();
+    CB_RES_L_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_L_1(this);
+        Z80_THREADED_NEXT();
+    CB_RES_HL_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_HL_1(this);
+        Z80_THREADED_NEXT();
+    CB_RES_A_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_A_1(this);
+        Z80_THREADED_NEXT();
+    CB_RES_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_B_2(this);
+        Z80_THREADED_NEXT();
+    CB_RES_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_C_2(this);
+        Z80_THREADED_NEXT();
+    CB_RES_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_D_2(this);
+        Z80_THREADED_NEXT();
+    CB_RES_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_E_2(this);
+        Z80_THREADED_NEXT();
+    CB_RES_H_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_H_2(this);
+        Z80_THREADED_NEXT();
+    CB_RES_L_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_L_2(this);
+        Z80_THREADED_NEXT();
+    CB_RES_HL_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_HL_2(this);
+        Z80_THREADED_NEXT();
+    CB_RES_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_A_2(this);
+        Z80_THREADED_NEXT();
+    CB_RES_B_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_B_3(this);
+        Z80_THREADED_NEXT();
+    CB_RES_C_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_C_3(this);
+        Z80_THREADED_NEXT();
+    CB_RES_D_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_D_3(this);
+        Z80_THREADED_NEXT();
+    CB_RES_E_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_E_3(this);
+        Z80_THREADED_NEXT();
+    CB_RES_H_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_H_3(this);
+        Z80_THREADED_NEXT();
+    CB_RES_L_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_L_3(this);
+        Z80_THREADED_NEXT();
+    CB_RES_HL_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_HL_3(this);
+        Z80_THREADED_NEXT();
+    CB_RES_A_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_A_3(this);
+        Z80_THREADED_NEXT();
+    CB_RES_B_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_B_4(this);
+        Z80_THREADED_NEXT();
+    CB_RES_C_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_C_4(this);
+        Z80_THREADED_NEXT();
+    CB_RES_D_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_D_4(this);
+        Z80_THREADED_NEXT();
+    CB_RES_E_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_E_4(this);
+        Z80_THREADED_NEXT();
+    CB_RES_H_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_H_4(this);
+        Z80_THREADED_NEXT();
+    CB_RES_L_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_L_4(this);
+        Z80_THREADED_NEXT();
+    CB_RES_HL_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_HL_4(this);
+        Z80_THREADED_NEXT();
+    CB_RES_A_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_A_4(this);
+        Z80_THREADED_NEXT();
+    CB_RES_B_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_B_5(this);
+        Z80_THREADED_NEXT();
+    CB_RES_C_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_C_5(this);
+        Z80_THREADED_NEXT();
+    CB_RES_D_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_D_5(this);
+        Z80_THREADED_NEXT();
+    CB_RES_E_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_E_5(this);
+        Z80_THREADED_NEXT();
+    CB_RES_H_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_H_5(this);
+        Z80_THREADED_NEXT();
+    CB_RES_L_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_L_5(this);
+        Z80_THREADED_NEXT();
+    CB_RES_HL_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_HL_5(this);
+        Z80_THREADED_NEXT();
+    CB_RES_A_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_A_5(this);
+        Z80_THREADED_NEXT();
+    CB_RES_B_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_B_6(this);
+        Z80_THREADED_NEXT();
+    CB_RES_C_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_C_6(this);
+        Z80_THREADED_NEXT();
+    CB_RES_D_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_D_6(this);
+        Z80_THREADED_NEXT();
+    CB_RES_E_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_E_6(this);
+        Z80_THREADED_NEXT();
+    CB_RES_H_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_H_6(this);
+        Z80_THREADED_NEXT();
+    CB_RES_L_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_L_6(this);
+        Z80_THREADED_NEXT();
+    CB_RES_HL_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_HL_6(this);
+        Z80_THREADED_NEXT();
+    CB_RES_A_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_A_6(this);
+        Z80_THREADED_NEXT();
+    CB_RES_B_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_B_7(this);
+        Z80_THREADED_NEXT();
+    CB_RES_C_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_C_7(this);
+        Z80_THREADED_NEXT();
+    CB_RES_D_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_D_7(this);
+        Z80_THREADED_NEXT();
+    CB_RES_E_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_E_7(this);
+        Z80_THREADED_NEXT();
+    CB_RES_H_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_H_7(this);
+        Z80_THREADED_NEXT();
+    CB_RES_L_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_L_7(this);
+        Z80_THREADED_NEXT();
+    CB_RES_HL_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_HL_7(this);
+        Z80_THREADED_NEXT();
+    CB_RES_A_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        RES_A_7(this);
+        Z80_THREADED_NEXT();
+    CB_SET_B_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_B_0(this);
+        Z80_THREADED_NEXT();
+    CB_SET_C_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_C_0(this);
+        Z80_THREADED_NEXT();
+    CB_SET_D_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_D_0(this);
+        Z80_THREADED_NEXT();
+    CB_SET_E_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_E_0(this);
+        Z80_THREADED_NEXT();
+    CB_SET_H_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_H_0(this);
+        Z80_THREADED_NEXT();
+    CB_SET_L_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_L_0(this);
+        Z80_THREADED_NEXT();
+    CB_SET_HL_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_HL_0(this);
+        Z80_THREADED_NEXT();
+    CB_SET_A_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_A_0(this);
+        Z80_THREADED_NEXT();
+    CB_SET_B_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_B_1(this);
+        Z80_THREADED_NEXT();
+    CB_SET_C_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_C_1(this);
+        Z80_THREADED_NEXT();
+    CB_SET_D_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_D_1(this);
+        Z80_THREADED_NEXT();
+    CB_SET_E_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_E_1(this);
+        Z80_THREADED_NEXT();
+    CB_SET_H_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_H_1(this);
+        Z80_THREADED_NEXT();
+    CB_SET_L_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_L_1(this);
+        Z80_THREADED_NEXT();
+    CB_SET_HL_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_HL_1(this);
+        Z80_THREADED_NEXT();
+    CB_SET_A_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_A_1(this);
+        Z80_THREADED_NEXT();
+    CB_SET_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_B_2(this);
+        Z80_THREADED_NEXT();
+    CB_SET_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_C_2(this);
+        Z80_THREADED_NEXT();
+    CB_SET_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_D_2(this);
+        Z80_THREADED_NEXT();
+    CB_SET_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_E_2(this);
+        Z80_THREADED_NEXT();
+    CB_SET_H_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_H_2(this);
+        Z80_THREADED_NEXT();
+    CB_SET_L_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_L_2(this);
+        Z80_THREADED_NEXT();
+    CB_SET_HL_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_HL_2(this);
+        Z80_THREADED_NEXT();
+    CB_SET_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_A_2(this);
+        Z80_THREADED_NEXT();
+    CB_SET_B_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_B_3(this);
+        Z80_THREADED_NEXT();
+    CB_SET_C_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_C_3(this);
+        Z80_THREADED_NEXT();
+    CB_SET_D_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_D_3(this);
+        Z80_THREADED_NEXT();
+    CB_SET_E_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_E_3(this);
+        Z80_THREADED_NEXT();
+    CB_SET_H_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_H_3(this);
+        Z80_THREADED_NEXT();
+    CB_SET_L_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_L_3(this);
+        Z80_THREADED_NEXT();
+    CB_SET_HL_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_HL_3(this);
+        Z80_THREADED_NEXT();
+    CB_SET_A_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_A_3(this);
+        Z80_THREADED_NEXT();
+    CB_SET_B_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_B_4(this);
+        Z80_THREADED_NEXT();
+    CB_SET_C_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_C_4(this);
+        Z80_THREADED_NEXT();
+    CB_SET_D_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_D_4(this);
+        Z80_THREADED_NEXT();
+    CB_SET_E_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_E_4(this);
+        Z80_THREADED_NEXT();
+    CB_SET_H_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_H_4(this);
+        Z80_THREADED_NEXT();
+    CB_SET_L_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_L_4(this);
+        Z80_THREADED_NEXT();
+    CB_SET_HL_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_HL_4(this);
+        Z80_THREADED_NEXT();
+    CB_SET_A_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_A_4(this);
+        Z80_THREADED_NEXT();
+    CB_SET_B_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_B_5(this);
+        Z80_THREADED_NEXT();
+    CB_SET_C_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_C_5(this);
+        Z80_THREADED_NEXT();
+    CB_SET_D_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_D_5(this);
+        Z80_THREADED_NEXT();
+    CB_SET_E_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_E_5(this);
+        Z80_THREADED_NEXT();
+    CB_SET_H_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_H_5(this);
+        Z80_THREADED_NEXT();
+    CB_SET_L_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_L_5(this);
+        Z80_THREADED_NEXT();
+    CB_SET_HL_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_HL_5(this);
+        Z80_THREADED_NEXT();
+    CB_SET_A_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_A_5(this);
+        Z80_THREADED_NEXT();
+    CB_SET_B_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_B_6(this);
+        Z80_THREADED_NEXT();
+    CB_SET_C_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_C_6(this);
+        Z80_THREADED_NEXT();
+    CB_SET_D_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_D_6(this);
+        Z80_THREADED_NEXT();
+    CB_SET_E_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_E_6(this);
+        Z80_THREADED_NEXT();
+    CB_SET_H_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_H_6(this);
+        Z80_THREADED_NEXT();
+    CB_SET_L_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_L_6(this);
+        Z80_THREADED_NEXT();
+    CB_SET_HL_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_HL_6(this);
+        Z80_THREADED_NEXT();
+    CB_SET_A_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_A_6(this);
+        Z80_THREADED_NEXT();
+    CB_SET_B_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_B_7(this);
+        Z80_THREADED_NEXT();
+    CB_SET_C_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_C_7(this);
+        Z80_THREADED_NEXT();
+    CB_SET_D_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_D_7(this);
+        Z80_THREADED_NEXT();
+    CB_SET_E_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_E_7(this);
+        Z80_THREADED_NEXT();
+    CB_SET_H_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_H_7(this);
+        Z80_THREADED_NEXT();
+    CB_SET_L_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_L_7(this);
+        Z80_THREADED_NEXT();
+    CB_SET_HL_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_HL_7(this);
+        Z80_THREADED_NEXT();
+    CB_SET_A_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandCB(operandNumber));
+        SET_A_7(this);
+        Z80_THREADED_NEXT();
+    ED_UNKNOWN:
+#ifndef Z80_NO_EXCEPTION
+        {
+            char buf[80];
+            snprintf(buf, sizeof(buf), "detect an unknown operand (ED,%02X)", operandNumber);
+            throw std::runtime_error(buf);
+        }
+#endif
+        Z80_THREADED_NEXT();
+    ED_IN_B_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        IN_B_C(this);
+        Z80_THREADED_NEXT();
+    ED_OUT_C_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        OUT_C_B(this);
+        Z80_THREADED_NEXT();
+    ED_SBC_HL_BC:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        SBC_HL_BC(this);
+        Z80_THREADED_NEXT();
+    ED_LD_ADDR_RP_BC:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        LD_ADDR_RP_BC(this);
+        Z80_THREADED_NEXT();
+    ED_NEG_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        NEG_(this);
+        Z80_THREADED_NEXT();
+    ED_RETN_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        RETN_(this);
+        Z80_THREADED_NEXT();
+    ED_IM0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        IM0(this);
+        Z80_THREADED_NEXT();
+    ED_LD_I_A_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        LD_I_A_(this);
+        Z80_THREADED_NEXT();
+    ED_IN_C_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        IN_C_C(this);
+        Z80_THREADED_NEXT();
+    ED_OUT_C_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        OUT_C_C(this);
+        Z80_THREADED_NEXT();
+    ED_ADC_HL_BC:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        ADC_HL_BC(this);
+        Z80_THREADED_NEXT();
+    ED_LD_RP_ADDR_BC:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        LD_RP_ADDR_BC(this);
+        Z80_THREADED_NEXT();
+    ED_RETI_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        RETI_(this);
+        Z80_THREADED_NEXT();
+    ED_LD_R_A_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        LD_R_A_(this);
+        Z80_THREADED_NEXT();
+    ED_IN_D_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        IN_D_C(this);
+        Z80_THREADED_NEXT();
+    ED_OUT_C_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        OUT_C_D(this);
+        Z80_THREADED_NEXT();
+    ED_SBC_HL_DE:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        SBC_HL_DE(this);
+        Z80_THREADED_NEXT();
+    ED_LD_ADDR_RP_DE:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        LD_ADDR_RP_DE(this);
+        Z80_THREADED_NEXT();
+    ED_IM1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        IM1(this);
+        Z80_THREADED_NEXT();
+    ED_LD_A_I_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        LD_A_I_(this);
+        Z80_THREADED_NEXT();
+    ED_IN_E_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        IN_E_C(this);
+        Z80_THREADED_NEXT();
+    ED_OUT_C_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        OUT_C_E(this);
+        Z80_THREADED_NEXT();
+    ED_ADC_HL_DE:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        ADC_HL_DE(this);
+        Z80_THREADED_NEXT();
+    ED_LD_RP_ADDR_DE:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        LD_RP_ADDR_DE(this);
+        Z80_THREADED_NEXT();
+    ED_IM2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        IM2(this);
+        Z80_THREADED_NEXT();
+    ED_LD_A_R_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        LD_A_R_(this);
+        Z80_THREADED_NEXT();
+    ED_IN_H_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        IN_H_C(this);
+        Z80_THREADED_NEXT();
+    ED_OUT_C_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        OUT_C_H(this);
+        Z80_THREADED_NEXT();
+    ED_SBC_HL_HL:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        SBC_HL_HL(this);
+        Z80_THREADED_NEXT();
+    ED_LD_ADDR_RP_HL:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        LD_ADDR_RP_HL(this);
+        Z80_THREADED_NEXT();
+    ED_RRD_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        RRD_(this);
+        Z80_THREADED_NEXT();
+    ED_IN_L_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        IN_L_C(this);
+        Z80_THREADED_NEXT();
+    ED_OUT_C_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        OUT_C_L(this);
+        Z80_THREADED_NEXT();
+    ED_ADC_HL_HL:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        ADC_HL_HL(this);
+        Z80_THREADED_NEXT();
+    ED_LD_RP_ADDR_HL:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        LD_RP_ADDR_HL(this);
+        Z80_THREADED_NEXT();
+    ED_RLD_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        RLD_(this);
+        Z80_THREADED_NEXT();
+    ED_IN_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        IN_C(this);
+        Z80_THREADED_NEXT();
+    ED_OUT_C_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        OUT_C_0(this);
+        Z80_THREADED_NEXT();
+    ED_SBC_HL_SP:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        SBC_HL_SP(this);
+        Z80_THREADED_NEXT();
+    ED_LD_ADDR_RP_SP:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        LD_ADDR_RP_SP(this);
+        Z80_THREADED_NEXT();
+    ED_IN_A_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        IN_A_C(this);
+        Z80_THREADED_NEXT();
+    ED_OUT_C_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        OUT_C_A(this);
+        Z80_THREADED_NEXT();
+    ED_ADC_HL_SP:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        ADC_HL_SP(this);
+        Z80_THREADED_NEXT();
+    ED_LD_RP_ADDR_SP:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        LD_RP_ADDR_SP(this);
+        Z80_THREADED_NEXT();
+    ED_LDI:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        LDI(this);
+        Z80_THREADED_NEXT();
+    ED_CPI:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        CPI(this);
+        Z80_THREADED_NEXT();
+    ED_INI:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        INI(this);
+        Z80_THREADED_NEXT();
+    ED_OUTI:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        OUTI(this);
+        Z80_THREADED_NEXT();
+    ED_LDD:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        LDD(this);
+        Z80_THREADED_NEXT();
+    ED_CPD:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        CPD(this);
+        Z80_THREADED_NEXT();
+    ED_IND:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        IND(this);
+        Z80_THREADED_NEXT();
+    ED_OUTD:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        OUTD(this);
+        Z80_THREADED_NEXT();
+    ED_LDIR:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        LDIR(this);
+        Z80_THREADED_NEXT();
+    ED_CPIR:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        CPIR(this);
+        Z80_THREADED_NEXT();
+    ED_INIR:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        INIR(this);
+        Z80_THREADED_NEXT();
+    ED_OUTIR:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        OUTIR(this);
+        Z80_THREADED_NEXT();
+    ED_LDDR:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        LDDR(this);
+        Z80_THREADED_NEXT();
+    ED_CPDR:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        CPDR(this);
+        Z80_THREADED_NEXT();
+    ED_INDR:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        INDR(this);
+        Z80_THREADED_NEXT();
+    ED_OUTDR:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandED(operandNumber));
+        OUTDR(this);
+        Z80_THREADED_NEXT();
+    IX_UNKNOWN:
+#ifndef Z80_NO_EXCEPTION
+        {
+            char buf[80];
+            snprintf(buf, sizeof(buf), "detect an unknown operand (DD,%02X)", operandNumber);
+            throw std::runtime_error(buf);
+        }
+#endif
+        Z80_THREADED_NEXT();
+    IX_INC_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        INC_B_2(this);
+        Z80_THREADED_NEXT();
+    IX_DEC_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        DEC_B_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_B_N_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_B_N_3(this);
+        Z80_THREADED_NEXT();
+    IX_ADD_IX_BC:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADD_IX_BC(this);
+        Z80_THREADED_NEXT();
+    IX_INC_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        INC_C_2(this);
+        Z80_THREADED_NEXT();
+    IX_DEC_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        DEC_C_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_C_N_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_C_N_3(this);
+        Z80_THREADED_NEXT();
+    IX_INC_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        INC_D_2(this);
+        Z80_THREADED_NEXT();
+    IX_DEC_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        DEC_D_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_D_N_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_D_N_3(this);
+        Z80_THREADED_NEXT();
+    IX_ADD_IX_DE:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADD_IX_DE(this);
+        Z80_THREADED_NEXT();
+    IX_INC_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        INC_E_2(this);
+        Z80_THREADED_NEXT();
+    IX_DEC_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        DEC_E_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_E_N_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_E_N_3(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IX_NN_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IX_NN_(this);
+        Z80_THREADED_NEXT();
+    IX_LD_ADDR_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_ADDR_IX_(this);
+        Z80_THREADED_NEXT();
+    IX_INC_IX_reg_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        INC_IX_reg_(this);
+        Z80_THREADED_NEXT();
+    IX_INC_IXH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        INC_IXH_(this);
+        Z80_THREADED_NEXT();
+    IX_DEC_IXH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        DEC_IXH_(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IXH_N_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IXH_N_(this);
+        Z80_THREADED_NEXT();
+    IX_ADD_IX_IX:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADD_IX_IX(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IX_ADDR_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IX_ADDR_(this);
+        Z80_THREADED_NEXT();
+    IX_DEC_IX_reg_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        DEC_IX_reg_(this);
+        Z80_THREADED_NEXT();
+    IX_INC_IXL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        INC_IXL_(this);
+        Z80_THREADED_NEXT();
+    IX_DEC_IXL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        DEC_IXL_(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IXL_N_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IXL_N_(this);
+        Z80_THREADED_NEXT();
+    IX_INC_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        INC_IX_(this);
+        Z80_THREADED_NEXT();
+    IX_DEC_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        DEC_IX_(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IX_N_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IX_N_(this);
+        Z80_THREADED_NEXT();
+    IX_ADD_IX_SP:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADD_IX_SP(this);
+        Z80_THREADED_NEXT();
+    IX_INC_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        INC_A_2(this);
+        Z80_THREADED_NEXT();
+    IX_DEC_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        DEC_A_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_A_N_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_A_N_3(this);
+        Z80_THREADED_NEXT();
+    IX_LD_B_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_B_B_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_B_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_B_C_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_B_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_B_D_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_B_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_B_E_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_B_IXH:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_B_IXH(this);
+        Z80_THREADED_NEXT();
+    IX_LD_B_IXL:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_B_IXL(this);
+        Z80_THREADED_NEXT();
+    IX_LD_B_IX:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_B_IX(this);
+        Z80_THREADED_NEXT();
+    IX_LD_B_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_B_A_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_C_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_C_B_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_C_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_C_C_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_C_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_C_D_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_C_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_C_E_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_C_IXH:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_C_IXH(this);
+        Z80_THREADED_NEXT();
+    IX_LD_C_IXL:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_C_IXL(this);
+        Z80_THREADED_NEXT();
+    IX_LD_C_IX:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_C_IX(this);
+        Z80_THREADED_NEXT();
+    IX_LD_C_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_C_A_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_D_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_D_B_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_D_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_D_C_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_D_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_D_D_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_D_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_D_E_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_D_IXH:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_D_IXH(this);
+        Z80_THREADED_NEXT();
+    IX_LD_D_IXL:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_D_IXL(this);
+        Z80_THREADED_NEXT();
+    IX_LD_D_IX:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_D_IX(this);
+        Z80_THREADED_NEXT();
+    IX_LD_D_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_D_A_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_E_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_E_B_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_E_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_E_C_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_E_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_E_D_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_E_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_E_E_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_E_IXH:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_E_IXH(this);
+        Z80_THREADED_NEXT();
+    IX_LD_E_IXL:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_E_IXL(this);
+        Z80_THREADED_NEXT();
+    IX_LD_E_IX:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_E_IX(this);
+        Z80_THREADED_NEXT();
+    IX_LD_E_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_E_A_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IXH_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IXH_B(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IXH_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IXH_C(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IXH_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IXH_D(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IXH_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IXH_E(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IXH_IXH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IXH_IXH_(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IXH_IXL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IXH_IXL_(this);
+        Z80_THREADED_NEXT();
+    IX_LD_H_IX:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_H_IX(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IXH_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IXH_A(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IXL_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IXL_B(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IXL_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IXL_C(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IXL_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IXL_D(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IXL_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IXL_E(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IXL_IXH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IXL_IXH_(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IXL_IXL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IXL_IXL_(this);
+        Z80_THREADED_NEXT();
+    IX_LD_L_IX:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_L_IX(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IXL_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IXL_A(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IX_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IX_B(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IX_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IX_C(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IX_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IX_D(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IX_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IX_E(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IX_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IX_H(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IX_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IX_L(this);
+        Z80_THREADED_NEXT();
+    IX_LD_IX_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_IX_A(this);
+        Z80_THREADED_NEXT();
+    IX_LD_A_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_A_B_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_A_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_A_C_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_A_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_A_D_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_A_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_A_E_2(this);
+        Z80_THREADED_NEXT();
+    IX_LD_A_IXH:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_A_IXH(this);
+        Z80_THREADED_NEXT();
+    IX_LD_A_IXL:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_A_IXL(this);
+        Z80_THREADED_NEXT();
+    IX_LD_A_IX:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_A_IX(this);
+        Z80_THREADED_NEXT();
+    IX_LD_A_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_A_A_2(this);
+        Z80_THREADED_NEXT();
+    IX_ADD_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADD_B_2(this);
+        Z80_THREADED_NEXT();
+    IX_ADD_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADD_C_2(this);
+        Z80_THREADED_NEXT();
+    IX_ADD_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADD_D_2(this);
+        Z80_THREADED_NEXT();
+    IX_ADD_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADD_E_2(this);
+        Z80_THREADED_NEXT();
+    IX_ADD_IXH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADD_IXH_(this);
+        Z80_THREADED_NEXT();
+    IX_ADD_IXL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADD_IXL_(this);
+        Z80_THREADED_NEXT();
+    IX_ADD_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADD_IX_(this);
+        Z80_THREADED_NEXT();
+    IX_ADD_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADD_A_2(this);
+        Z80_THREADED_NEXT();
+    IX_ADC_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADC_B_2(this);
+        Z80_THREADED_NEXT();
+    IX_ADC_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADC_C_2(this);
+        Z80_THREADED_NEXT();
+    IX_ADC_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADC_D_2(this);
+        Z80_THREADED_NEXT();
+    IX_ADC_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADC_E_2(this);
+        Z80_THREADED_NEXT();
+    IX_ADC_IXH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADC_IXH_(this);
+        Z80_THREADED_NEXT();
+    IX_ADC_IXL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADC_IXL_(this);
+        Z80_THREADED_NEXT();
+    IX_ADC_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADC_IX_(this);
+        Z80_THREADED_NEXT();
+    IX_ADC_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        ADC_A_2(this);
+        Z80_THREADED_NEXT();
+    IX_SUB_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        SUB_B_2(this);
+        Z80_THREADED_NEXT();
+    IX_SUB_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        SUB_C_2(this);
+        Z80_THREADED_NEXT();
+    IX_SUB_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        SUB_D_2(this);
+        Z80_THREADED_NEXT();
+    IX_SUB_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        SUB_E_2(this);
+        Z80_THREADED_NEXT();
+    IX_SUB_IXH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        SUB_IXH_(this);
+        Z80_THREADED_NEXT();
+    IX_SUB_IXL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        SUB_IXL_(this);
+        Z80_THREADED_NEXT();
+    IX_SUB_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        SUB_IX_(this);
+        Z80_THREADED_NEXT();
+    IX_SUB_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        SUB_A_2(this);
+        Z80_THREADED_NEXT();
+    IX_SBC_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        SBC_B_2(this);
+        Z80_THREADED_NEXT();
+    IX_SBC_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        SBC_C_2(this);
+        Z80_THREADED_NEXT();
+    IX_SBC_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        SBC_D_2(this);
+        Z80_THREADED_NEXT();
+    IX_SBC_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        SBC_E_2(this);
+        Z80_THREADED_NEXT();
+    IX_SBC_IXH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        SBC_IXH_(this);
+        Z80_THREADED_NEXT();
+    IX_SBC_IXL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        SBC_IXL_(this);
+        Z80_THREADED_NEXT();
+    IX_SBC_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        SBC_IX_(this);
+        Z80_THREADED_NEXT();
+    IX_SBC_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        SBC_A_2(this);
+        Z80_THREADED_NEXT();
+    IX_AND_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        AND_B_2(this);
+        Z80_THREADED_NEXT();
+    IX_AND_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        AND_C_2(this);
+        Z80_THREADED_NEXT();
+    IX_AND_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        AND_D_2(this);
+        Z80_THREADED_NEXT();
+    IX_AND_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        AND_E_2(this);
+        Z80_THREADED_NEXT();
+    IX_AND_IXH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        AND_IXH_(this);
+        Z80_THREADED_NEXT();
+    IX_AND_IXL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        AND_IXL_(this);
+        Z80_THREADED_NEXT();
+    IX_AND_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        AND_IX_(this);
+        Z80_THREADED_NEXT();
+    IX_AND_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        AND_A_2(this);
+        Z80_THREADED_NEXT();
+    IX_XOR_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        XOR_B_2(this);
+        Z80_THREADED_NEXT();
+    IX_XOR_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        XOR_C_2(this);
+        Z80_THREADED_NEXT();
+    IX_XOR_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        XOR_D_2(this);
+        Z80_THREADED_NEXT();
+    IX_XOR_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        XOR_E_2(this);
+        Z80_THREADED_NEXT();
+    IX_XOR_IXH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        XOR_IXH_(this);
+        Z80_THREADED_NEXT();
+    IX_XOR_IXL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        XOR_IXL_(this);
+        Z80_THREADED_NEXT();
+    IX_XOR_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        XOR_IX_(this);
+        Z80_THREADED_NEXT();
+    IX_XOR_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        XOR_A_2(this);
+        Z80_THREADED_NEXT();
+    IX_OR_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        OR_B_2(this);
+        Z80_THREADED_NEXT();
+    IX_OR_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        OR_C_2(this);
+        Z80_THREADED_NEXT();
+    IX_OR_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        OR_D_2(this);
+        Z80_THREADED_NEXT();
+    IX_OR_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        OR_E_2(this);
+        Z80_THREADED_NEXT();
+    IX_OR_IXH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        OR_IXH_(this);
+        Z80_THREADED_NEXT();
+    IX_OR_IXL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        OR_IXL_(this);
+        Z80_THREADED_NEXT();
+    IX_OR_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        OR_IX_(this);
+        Z80_THREADED_NEXT();
+    IX_OR_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        OR_A_2(this);
+        Z80_THREADED_NEXT();
+    IX_CP_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        CP_B_2(this);
+        Z80_THREADED_NEXT();
+    IX_CP_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        CP_C_2(this);
+        Z80_THREADED_NEXT();
+    IX_CP_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        CP_D_2(this);
+        Z80_THREADED_NEXT();
+    IX_CP_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        CP_E_2(this);
+        Z80_THREADED_NEXT();
+    IX_CP_IXH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        CP_IXH_(this);
+        Z80_THREADED_NEXT();
+    IX_CP_IXL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        CP_IXL_(this);
+        Z80_THREADED_NEXT();
+    IX_CP_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        CP_IX_(this);
+        Z80_THREADED_NEXT();
+    IX_CP_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        CP_A_2(this);
+        Z80_THREADED_NEXT();
+    IX_OP_IX4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        d = (signed char)fetch(4);
+        operandNumber = fetch(4);
+        goto* labelIX4[operandNumber];
+    IX_POP_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        POP_IX_(this);
+        Z80_THREADED_NEXT();
+    IX_EX_SP_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        EX_SP_IX_(this);
+        Z80_THREADED_NEXT();
+    IX_PUSH_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        PUSH_IX_(this);
+        Z80_THREADED_NEXT();
+    IX_JP_IX:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        JP_IX(this);
+        Z80_THREADED_NEXT();
+    IX_LD_SP_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX(operandNumber));
+        LD_SP_IX_(this);
+        Z80_THREADED_NEXT();
+    IY_UNKNOWN:
+#ifndef Z80_NO_EXCEPTION
+        {
+            char buf[80];
+            snprintf(buf, sizeof(buf), "detect an unknown operand (FD,%02X)", operandNumber);
+            throw std::runtime_error(buf);
+        }
+#endif
+        Z80_THREADED_NEXT();
+    IY_INC_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        INC_B_2(this);
+        Z80_THREADED_NEXT();
+    IY_DEC_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        DEC_B_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_B_N_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_B_N_3(this);
+        Z80_THREADED_NEXT();
+    IY_ADD_IY_BC:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADD_IY_BC(this);
+        Z80_THREADED_NEXT();
+    IY_INC_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        INC_C_2(this);
+        Z80_THREADED_NEXT();
+    IY_DEC_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        DEC_C_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_C_N_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_C_N_3(this);
+        Z80_THREADED_NEXT();
+    IY_INC_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        INC_D_2(this);
+        Z80_THREADED_NEXT();
+    IY_DEC_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        DEC_D_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_D_N_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_D_N_3(this);
+        Z80_THREADED_NEXT();
+    IY_ADD_IY_DE:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADD_IY_DE(this);
+        Z80_THREADED_NEXT();
+    IY_INC_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        INC_E_2(this);
+        Z80_THREADED_NEXT();
+    IY_DEC_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        DEC_E_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_E_N_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_E_N_3(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IY_NN_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IY_NN_(this);
+        Z80_THREADED_NEXT();
+    IY_LD_ADDR_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_ADDR_IY_(this);
+        Z80_THREADED_NEXT();
+    IY_INC_IY_reg_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        INC_IY_reg_(this);
+        Z80_THREADED_NEXT();
+    IY_INC_IYH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        INC_IYH_(this);
+        Z80_THREADED_NEXT();
+    IY_DEC_IYH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        DEC_IYH_(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IYH_N_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IYH_N_(this);
+        Z80_THREADED_NEXT();
+    IY_ADD_IY_IY:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADD_IY_IY(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IY_ADDR_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IY_ADDR_(this);
+        Z80_THREADED_NEXT();
+    IY_DEC_IY_reg_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        DEC_IY_reg_(this);
+        Z80_THREADED_NEXT();
+    IY_INC_IYL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        INC_IYL_(this);
+        Z80_THREADED_NEXT();
+    IY_DEC_IYL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        DEC_IYL_(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IYL_N_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IYL_N_(this);
+        Z80_THREADED_NEXT();
+    IY_INC_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        INC_IY_(this);
+        Z80_THREADED_NEXT();
+    IY_DEC_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        DEC_IY_(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IY_N_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IY_N_(this);
+        Z80_THREADED_NEXT();
+    IY_ADD_IY_SP:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADD_IY_SP(this);
+        Z80_THREADED_NEXT();
+    IY_INC_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        INC_A_2(this);
+        Z80_THREADED_NEXT();
+    IY_DEC_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        DEC_A_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_A_N_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_A_N_3(this);
+        Z80_THREADED_NEXT();
+    IY_LD_B_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_B_B_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_B_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_B_C_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_B_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_B_D_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_B_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_B_E_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_B_IYH:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_B_IYH(this);
+        Z80_THREADED_NEXT();
+    IY_LD_B_IYL:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_B_IYL(this);
+        Z80_THREADED_NEXT();
+    IY_LD_B_IY:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_B_IY(this);
+        Z80_THREADED_NEXT();
+    IY_LD_B_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_B_A_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_C_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_C_B_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_C_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_C_C_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_C_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_C_D_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_C_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_C_E_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_C_IYH:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_C_IYH(this);
+        Z80_THREADED_NEXT();
+    IY_LD_C_IYL:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_C_IYL(this);
+        Z80_THREADED_NEXT();
+    IY_LD_C_IY:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_C_IY(this);
+        Z80_THREADED_NEXT();
+    IY_LD_C_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_C_A_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_D_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_D_B_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_D_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_D_C_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_D_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_D_D_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_D_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_D_E_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_D_IYH:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_D_IYH(this);
+        Z80_THREADED_NEXT();
+    IY_LD_D_IYL:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_D_IYL(this);
+        Z80_THREADED_NEXT();
+    IY_LD_D_IY:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_D_IY(this);
+        Z80_THREADED_NEXT();
+    IY_LD_D_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_D_A_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_E_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_E_B_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_E_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_E_C_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_E_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_E_D_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_E_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_E_E_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_E_IYH:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_E_IYH(this);
+        Z80_THREADED_NEXT();
+    IY_LD_E_IYL:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_E_IYL(this);
+        Z80_THREADED_NEXT();
+    IY_LD_E_IY:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_E_IY(this);
+        Z80_THREADED_NEXT();
+    IY_LD_E_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_E_A_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IYH_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IYH_B(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IYH_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IYH_C(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IYH_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IYH_D(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IYH_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IYH_E(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IYH_IYH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IYH_IYH_(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IYH_IYL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IYH_IYL_(this);
+        Z80_THREADED_NEXT();
+    IY_LD_H_IY:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_H_IY(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IYH_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IYH_A(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IYL_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IYL_B(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IYL_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IYL_C(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IYL_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IYL_D(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IYL_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IYL_E(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IYL_IYH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IYL_IYH_(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IYL_IYL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IYL_IYL_(this);
+        Z80_THREADED_NEXT();
+    IY_LD_L_IY:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_L_IY(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IYL_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IYL_A(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IY_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IY_B(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IY_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IY_C(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IY_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IY_D(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IY_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IY_E(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IY_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IY_H(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IY_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IY_L(this);
+        Z80_THREADED_NEXT();
+    IY_LD_IY_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_IY_A(this);
+        Z80_THREADED_NEXT();
+    IY_LD_A_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_A_B_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_A_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_A_C_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_A_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_A_D_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_A_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_A_E_2(this);
+        Z80_THREADED_NEXT();
+    IY_LD_A_IYH:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_A_IYH(this);
+        Z80_THREADED_NEXT();
+    IY_LD_A_IYL:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_A_IYL(this);
+        Z80_THREADED_NEXT();
+    IY_LD_A_IY:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_A_IY(this);
+        Z80_THREADED_NEXT();
+    IY_LD_A_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_A_A_2(this);
+        Z80_THREADED_NEXT();
+    IY_ADD_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADD_B_2(this);
+        Z80_THREADED_NEXT();
+    IY_ADD_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADD_C_2(this);
+        Z80_THREADED_NEXT();
+    IY_ADD_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADD_D_2(this);
+        Z80_THREADED_NEXT();
+    IY_ADD_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADD_E_2(this);
+        Z80_THREADED_NEXT();
+    IY_ADD_IYH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADD_IYH_(this);
+        Z80_THREADED_NEXT();
+    IY_ADD_IYL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADD_IYL_(this);
+        Z80_THREADED_NEXT();
+    IY_ADD_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADD_IY_(this);
+        Z80_THREADED_NEXT();
+    IY_ADD_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADD_A_2(this);
+        Z80_THREADED_NEXT();
+    IY_ADC_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADC_B_2(this);
+        Z80_THREADED_NEXT();
+    IY_ADC_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADC_C_2(this);
+        Z80_THREADED_NEXT();
+    IY_ADC_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADC_D_2(this);
+        Z80_THREADED_NEXT();
+    IY_ADC_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADC_E_2(this);
+        Z80_THREADED_NEXT();
+    IY_ADC_IYH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADC_IYH_(this);
+        Z80_THREADED_NEXT();
+    IY_ADC_IYL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADC_IYL_(this);
+        Z80_THREADED_NEXT();
+    IY_ADC_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADC_IY_(this);
+        Z80_THREADED_NEXT();
+    IY_ADC_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        ADC_A_2(this);
+        Z80_THREADED_NEXT();
+    IY_SUB_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        SUB_B_2(this);
+        Z80_THREADED_NEXT();
+    IY_SUB_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        SUB_C_2(this);
+        Z80_THREADED_NEXT();
+    IY_SUB_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        SUB_D_2(this);
+        Z80_THREADED_NEXT();
+    IY_SUB_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        SUB_E_2(this);
+        Z80_THREADED_NEXT();
+    IY_SUB_IYH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        SUB_IYH_(this);
+        Z80_THREADED_NEXT();
+    IY_SUB_IYL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        SUB_IYL_(this);
+        Z80_THREADED_NEXT();
+    IY_SUB_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        SUB_IY_(this);
+        Z80_THREADED_NEXT();
+    IY_SUB_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        SUB_A_2(this);
+        Z80_THREADED_NEXT();
+    IY_SBC_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        SBC_B_2(this);
+        Z80_THREADED_NEXT();
+    IY_SBC_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        SBC_C_2(this);
+        Z80_THREADED_NEXT();
+    IY_SBC_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        SBC_D_2(this);
+        Z80_THREADED_NEXT();
+    IY_SBC_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        SBC_E_2(this);
+        Z80_THREADED_NEXT();
+    IY_SBC_IYH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        SBC_IYH_(this);
+        Z80_THREADED_NEXT();
+    IY_SBC_IYL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        SBC_IYL_(this);
+        Z80_THREADED_NEXT();
+    IY_SBC_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        SBC_IY_(this);
+        Z80_THREADED_NEXT();
+    IY_SBC_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        SBC_A_2(this);
+        Z80_THREADED_NEXT();
+    IY_AND_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        AND_B_2(this);
+        Z80_THREADED_NEXT();
+    IY_AND_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        AND_C_2(this);
+        Z80_THREADED_NEXT();
+    IY_AND_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        AND_D_2(this);
+        Z80_THREADED_NEXT();
+    IY_AND_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        AND_E_2(this);
+        Z80_THREADED_NEXT();
+    IY_AND_IYH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        AND_IYH_(this);
+        Z80_THREADED_NEXT();
+    IY_AND_IYL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        AND_IYL_(this);
+        Z80_THREADED_NEXT();
+    IY_AND_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        AND_IY_(this);
+        Z80_THREADED_NEXT();
+    IY_AND_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        AND_A_2(this);
+        Z80_THREADED_NEXT();
+    IY_XOR_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        XOR_B_2(this);
+        Z80_THREADED_NEXT();
+    IY_XOR_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        XOR_C_2(this);
+        Z80_THREADED_NEXT();
+    IY_XOR_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        XOR_D_2(this);
+        Z80_THREADED_NEXT();
+    IY_XOR_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        XOR_E_2(this);
+        Z80_THREADED_NEXT();
+    IY_XOR_IYH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        XOR_IYH_(this);
+        Z80_THREADED_NEXT();
+    IY_XOR_IYL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        XOR_IYL_(this);
+        Z80_THREADED_NEXT();
+    IY_XOR_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        XOR_IY_(this);
+        Z80_THREADED_NEXT();
+    IY_XOR_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        XOR_A_2(this);
+        Z80_THREADED_NEXT();
+    IY_OR_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        OR_B_2(this);
+        Z80_THREADED_NEXT();
+    IY_OR_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        OR_C_2(this);
+        Z80_THREADED_NEXT();
+    IY_OR_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        OR_D_2(this);
+        Z80_THREADED_NEXT();
+    IY_OR_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        OR_E_2(this);
+        Z80_THREADED_NEXT();
+    IY_OR_IYH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        OR_IYH_(this);
+        Z80_THREADED_NEXT();
+    IY_OR_IYL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        OR_IYL_(this);
+        Z80_THREADED_NEXT();
+    IY_OR_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        OR_IY_(this);
+        Z80_THREADED_NEXT();
+    IY_OR_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        OR_A_2(this);
+        Z80_THREADED_NEXT();
+    IY_CP_B_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        CP_B_2(this);
+        Z80_THREADED_NEXT();
+    IY_CP_C_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        CP_C_2(this);
+        Z80_THREADED_NEXT();
+    IY_CP_D_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        CP_D_2(this);
+        Z80_THREADED_NEXT();
+    IY_CP_E_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        CP_E_2(this);
+        Z80_THREADED_NEXT();
+    IY_CP_IYH_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        CP_IYH_(this);
+        Z80_THREADED_NEXT();
+    IY_CP_IYL_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        CP_IYL_(this);
+        Z80_THREADED_NEXT();
+    IY_CP_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        CP_IY_(this);
+        Z80_THREADED_NEXT();
+    IY_CP_A_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        CP_A_2(this);
+        Z80_THREADED_NEXT();
+    IY_OP_IY4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        d = (signed char)fetch(4);
+        operandNumber = fetch(4);
+        goto* labelIY4[operandNumber];
+    IY_POP_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        POP_IY_(this);
+        Z80_THREADED_NEXT();
+    IY_EX_SP_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        EX_SP_IY_(this);
+        Z80_THREADED_NEXT();
+    IY_PUSH_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        PUSH_IY_(this);
+        Z80_THREADED_NEXT();
+    IY_JP_IY:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        JP_IY(this);
+        Z80_THREADED_NEXT();
+    IY_LD_SP_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY(operandNumber));
+        LD_SP_IY_(this);
+        Z80_THREADED_NEXT();
+    IX4_RLC_IX_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RLC_IX_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RLC_IX_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RLC_IX_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RLC_IX_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RLC_IX_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RLC_IX_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RLC_IX_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RLC_IX_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RLC_IX_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RLC_IX_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RLC_IX_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RLC_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RLC_IX_(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RLC_IX_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RLC_IX_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RRC_IX_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RRC_IX_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RRC_IX_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RRC_IX_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RRC_IX_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RRC_IX_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RRC_IX_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RRC_IX_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RRC_IX_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RRC_IX_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RRC_IX_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RRC_IX_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RRC_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RRC_IX_(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RRC_IX_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RRC_IX_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RL_IX_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RL_IX_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RL_IX_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RL_IX_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RL_IX_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RL_IX_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RL_IX_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RL_IX_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RL_IX_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RL_IX_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RL_IX_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RL_IX_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RL_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RL_IX_(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RL_IX_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RL_IX_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RR_IX_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RR_IX_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RR_IX_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RR_IX_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RR_IX_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RR_IX_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RR_IX_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RR_IX_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RR_IX_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RR_IX_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RR_IX_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RR_IX_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RR_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RR_IX_(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RR_IX_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RR_IX_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SLA_IX_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SLA_IX_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SLA_IX_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SLA_IX_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SLA_IX_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SLA_IX_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SLA_IX_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SLA_IX_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SLA_IX_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SLA_IX_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SLA_IX_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SLA_IX_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SLA_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SLA_IX_(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SLA_IX_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SLA_IX_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SRA_IX_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SRA_IX_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SRA_IX_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SRA_IX_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SRA_IX_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SRA_IX_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SRA_IX_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SRA_IX_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SRA_IX_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SRA_IX_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SRA_IX_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SRA_IX_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SRA_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SRA_IX_(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SRA_IX_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SRA_IX_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SLL_IX_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SLL_IX_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SLL_IX_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SLL_IX_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SLL_IX_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SLL_IX_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SLL_IX_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SLL_IX_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SLL_IX_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SLL_IX_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SLL_IX_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SLL_IX_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SLL_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SLL_IX_(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SLL_IX_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SLL_IX_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SRL_IX_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SRL_IX_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SRL_IX_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SRL_IX_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SRL_IX_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SRL_IX_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SRL_IX_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SRL_IX_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SRL_IX_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SRL_IX_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SRL_IX_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SRL_IX_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SRL_IX_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SRL_IX_(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SRL_IX_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SRL_IX_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_BIT_IX_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        BIT_IX_0(this, d);
+        Z80_THREADED_NEXT();
+    IX4_BIT_IX_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        BIT_IX_1(this, d);
+        Z80_THREADED_NEXT();
+    IX4_BIT_IX_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        BIT_IX_2(this, d);
+        Z80_THREADED_NEXT();
+    IX4_BIT_IX_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        BIT_IX_3(this, d);
+        Z80_THREADED_NEXT();
+    IX4_BIT_IX_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        BIT_IX_4(this, d);
+        Z80_THREADED_NEXT();
+    IX4_BIT_IX_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        BIT_IX_5(this, d);
+        Z80_THREADED_NEXT();
+    IX4_BIT_IX_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        BIT_IX_6(this, d);
+        Z80_THREADED_NEXT();
+    IX4_BIT_IX_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        BIT_IX_7(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_0_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_0_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_0_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_0_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_0_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_0_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_0_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_0_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_0_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_0_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_0_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_0_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_0(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_0_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_0_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_1_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_1_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_1_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_1_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_1_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_1_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_1_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_1_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_1_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_1_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_1_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_1_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_1(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_1_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_1_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_2_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_2_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_2_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_2_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_2_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_2_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_2_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_2_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_2_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_2_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_2_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_2_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_2(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_2_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_2_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_3_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_3_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_3_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_3_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_3_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_3_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_3_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_3_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_3_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_3_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_3_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_3_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_3(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_3_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_3_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_4_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_4_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_4_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_4_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_4_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_4_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_4_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_4_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_4_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_4_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_4_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_4_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_4(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_4_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_4_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_5_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_5_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_5_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_5_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_5_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_5_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_5_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_5_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_5_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_5_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_5_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_5_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_5(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_5_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_5_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_6_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_6_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_6_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_6_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_6_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_6_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_6_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_6_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_6_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_6_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_6_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_6_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_6(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_6_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_6_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_7_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_7_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_7_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_7_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_7_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_7_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_7_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_7_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_7_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_7_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_7_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_7_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_7(this, d);
+        Z80_THREADED_NEXT();
+    IX4_RES_IX_7_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        RES_IX_7_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_0_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_0_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_0_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_0_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_0_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_0_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_0_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_0_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_0_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_0_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_0_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_0_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_0(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_0_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_0_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_1_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_1_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_1_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_1_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_1_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_1_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_1_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_1_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_1_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_1_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_1_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_1_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_1(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_1_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_1_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_2_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_2_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_2_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_2_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_2_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_2_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_2_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_2_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_2_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_2_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_2_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_2_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_2(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_2_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_2_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_3_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_3_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_3_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_3_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_3_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_3_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_3_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_3_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_3_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_3_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_3_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_3_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_3(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_3_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_3_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_4_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_4_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_4_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_4_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_4_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_4_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_4_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_4_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_4_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_4_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_4_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_4_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_4(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_4_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_4_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_5_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_5_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_5_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_5_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_5_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_5_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_5_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_5_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_5_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_5_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_5_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_5_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_5(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_5_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_5_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_6_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_6_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_6_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_6_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_6_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_6_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_6_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_6_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_6_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_6_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_6_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_6_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_6(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_6_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_6_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_7_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_7_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_7_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_7_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_7_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_7_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_7_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_7_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_7_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_7_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_7_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_7_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_7(this, d);
+        Z80_THREADED_NEXT();
+    IX4_SET_IX_7_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIX4(operandNumber));
+        SET_IX_7_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RLC_IY_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RLC_IY_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RLC_IY_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RLC_IY_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RLC_IY_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RLC_IY_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RLC_IY_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RLC_IY_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RLC_IY_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RLC_IY_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RLC_IY_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RLC_IY_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RLC_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RLC_IY_(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RLC_IY_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RLC_IY_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RRC_IY_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RRC_IY_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RRC_IY_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RRC_IY_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RRC_IY_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RRC_IY_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RRC_IY_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RRC_IY_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RRC_IY_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RRC_IY_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RRC_IY_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RRC_IY_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RRC_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RRC_IY_(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RRC_IY_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RRC_IY_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RL_IY_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RL_IY_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RL_IY_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RL_IY_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RL_IY_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RL_IY_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RL_IY_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RL_IY_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RL_IY_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RL_IY_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RL_IY_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RL_IY_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RL_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RL_IY_(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RL_IY_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RL_IY_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RR_IY_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RR_IY_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RR_IY_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RR_IY_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RR_IY_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RR_IY_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RR_IY_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RR_IY_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RR_IY_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RR_IY_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RR_IY_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RR_IY_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RR_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RR_IY_(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RR_IY_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RR_IY_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SLA_IY_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SLA_IY_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SLA_IY_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SLA_IY_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SLA_IY_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SLA_IY_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SLA_IY_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SLA_IY_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SLA_IY_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SLA_IY_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SLA_IY_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SLA_IY_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SLA_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SLA_IY_(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SLA_IY_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SLA_IY_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SRA_IY_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SRA_IY_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SRA_IY_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SRA_IY_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SRA_IY_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SRA_IY_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SRA_IY_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SRA_IY_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SRA_IY_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SRA_IY_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SRA_IY_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SRA_IY_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SRA_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SRA_IY_(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SRA_IY_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SRA_IY_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SLL_IY_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SLL_IY_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SLL_IY_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SLL_IY_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SLL_IY_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SLL_IY_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SLL_IY_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SLL_IY_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SLL_IY_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SLL_IY_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SLL_IY_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SLL_IY_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SLL_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SLL_IY_(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SLL_IY_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SLL_IY_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SRL_IY_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SRL_IY_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SRL_IY_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SRL_IY_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SRL_IY_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SRL_IY_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SRL_IY_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SRL_IY_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SRL_IY_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SRL_IY_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SRL_IY_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SRL_IY_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SRL_IY_:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SRL_IY_(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SRL_IY_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SRL_IY_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_BIT_IY_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        BIT_IY_0(this, d);
+        Z80_THREADED_NEXT();
+    IY4_BIT_IY_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        BIT_IY_1(this, d);
+        Z80_THREADED_NEXT();
+    IY4_BIT_IY_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        BIT_IY_2(this, d);
+        Z80_THREADED_NEXT();
+    IY4_BIT_IY_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        BIT_IY_3(this, d);
+        Z80_THREADED_NEXT();
+    IY4_BIT_IY_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        BIT_IY_4(this, d);
+        Z80_THREADED_NEXT();
+    IY4_BIT_IY_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        BIT_IY_5(this, d);
+        Z80_THREADED_NEXT();
+    IY4_BIT_IY_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        BIT_IY_6(this, d);
+        Z80_THREADED_NEXT();
+    IY4_BIT_IY_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        BIT_IY_7(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_0_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_0_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_0_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_0_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_0_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_0_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_0_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_0_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_0_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_0_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_0_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_0_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_0(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_0_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_0_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_1_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_1_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_1_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_1_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_1_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_1_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_1_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_1_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_1_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_1_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_1_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_1_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_1(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_1_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_1_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_2_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_2_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_2_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_2_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_2_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_2_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_2_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_2_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_2_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_2_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_2_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_2_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_2(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_2_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_2_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_3_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_3_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_3_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_3_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_3_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_3_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_3_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_3_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_3_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_3_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_3_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_3_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_3(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_3_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_3_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_4_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_4_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_4_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_4_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_4_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_4_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_4_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_4_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_4_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_4_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_4_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_4_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_4(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_4_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_4_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_5_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_5_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_5_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_5_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_5_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_5_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_5_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_5_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_5_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_5_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_5_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_5_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_5(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_5_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_5_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_6_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_6_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_6_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_6_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_6_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_6_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_6_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_6_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_6_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_6_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_6_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_6_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_6(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_6_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_6_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_7_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_7_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_7_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_7_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_7_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_7_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_7_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_7_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_7_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_7_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_7_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_7_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_7(this, d);
+        Z80_THREADED_NEXT();
+    IY4_RES_IY_7_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        RES_IY_7_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_0_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_0_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_0_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_0_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_0_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_0_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_0_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_0_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_0_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_0_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_0_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_0_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_0:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_0(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_0_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_0_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_1_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_1_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_1_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_1_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_1_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_1_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_1_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_1_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_1_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_1_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_1_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_1_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_1:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_1(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_1_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_1_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_2_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_2_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_2_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_2_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_2_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_2_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_2_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_2_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_2_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_2_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_2_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_2_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_2:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_2(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_2_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_2_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_3_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_3_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_3_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_3_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_3_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_3_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_3_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_3_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_3_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_3_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_3_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_3_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_3:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_3(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_3_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_3_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_4_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_4_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_4_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_4_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_4_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_4_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_4_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_4_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_4_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_4_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_4_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_4_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_4:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_4(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_4_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_4_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_5_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_5_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_5_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_5_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_5_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_5_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_5_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_5_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_5_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_5_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_5_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_5_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_5:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_5(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_5_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_5_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_6_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_6_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_6_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_6_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_6_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_6_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_6_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_6_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_6_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_6_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_6_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_6_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_6:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_6(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_6_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_6_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_7_with_LD_B:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_7_with_LD_B(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_7_with_LD_C:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_7_with_LD_C(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_7_with_LD_D:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_7_with_LD_D(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_7_with_LD_E:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_7_with_LD_E(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_7_with_LD_H:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_7_with_LD_H(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_7_with_LD_L:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_7_with_LD_L(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_7:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_7(this, d);
+        Z80_THREADED_NEXT();
+    IY4_SET_IY_7_with_LD_A:
+        Z80_THREADED_BREAK_OPERAND(checkBreakOperandIY4(operandNumber));
+        SET_IY_7_with_LD_A(this, d);
+        Z80_THREADED_NEXT();
+    }
+#undef Z80_THREADED_NEXT
+#undef Z80_THREADED_DISPATCH_NEXT
+#undef Z80_THREADED_END_INSTRUCTION
+#undef Z80_THREADED_BREAK_OPERAND
+#undef Z80_THREADED_BREAK_POINT
+#endif
+    // END: generated by tools/z80threaded
+
     inline int execute(int clock)
     {
+#ifdef Z80_THREADED_DISPATCH
+        return executeThreaded(clock);
+#else
         int executed = 0;
         requestBreakFlag = false;
         reg.consumeClockCounter = 0;
@@ -6428,6 +11783,7 @@ class Z80
 #endif
         }
         return executed;
+#endif
     }
 
     inline void execute()
@@ -6496,4 +11852,6 @@ class Z80
 #endif
 };
 
+typedef Z80Template<> Z80;
+
 #endif // INCLUDE_Z80_HPP
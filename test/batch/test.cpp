@@ -0,0 +1,140 @@
+/**
+ * Batch Runner Tester
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#include "../../src/msx2batch.hpp"
+#include <chrono>
+
+#define JOB_COUNT 16
+#define FRAME_COUNT 600
+
+void* loadFile(const char* path, size_t* size)
+{
+    FILE* fp = fopen(path, "rb");
+    if (!fp) {
+        printf("File not found: %s\n", path);
+        return nullptr;
+    }
+    fseek(fp, 0, SEEK_END);
+    *size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    void* result = malloc(*size);
+    if (!result) {
+        puts("No memory");
+        fclose(fp);
+        return nullptr;
+    }
+    if (*size != fread(result, 1, *size, fp)) {
+        printf("Read error: %s\n", path);
+        fclose(fp);
+        free(result);
+        return nullptr;
+    }
+    fclose(fp);
+    return result;
+}
+
+struct Rom {
+    void* data;
+    size_t size;
+} mainRom, logoRom, subRom;
+
+unsigned int hash(const void* data, size_t size, unsigned int h)
+{
+    const unsigned char* ptr = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        h = (h ^ ptr[i]) * 16777619;
+    }
+    return h;
+}
+
+// executes JOB_COUNT jobs (each job is FRAME_COUNT frames with a different key input) and returns the elapsed time
+int run(int threadCount, unsigned int* result)
+{
+    MSX2Batch batch(threadCount);
+    for (int i = 0; i < JOB_COUNT; i++) {
+        // odd jobs enable OPLL (YM2413) and play a tone by writing ports $7C and $7D directly
+        batch.add(0, i & 1 ? true : false, [i, result](MSX2* msx2) {
+            msx2->setupSecondaryExist(false, false, false, true);
+            msx2->setup(0, 0, 0, mainRom.data, (int)mainRom.size, "MAIN");
+            msx2->setup(0, 0, 4, logoRom.data, (int)logoRom.size, "LOGO");
+            msx2->setup(3, 0, 0, subRom.data, (int)subRom.size, "SUB");
+            msx2->setupRAM(3, 3);
+            msx2->reset();
+            if (msx2->ym2413) {
+                const unsigned char regs[] = {0x30, 0x10, 0x10, (unsigned char)(0x80 + i * 8), 0x20, 0x18};
+                for (int n = 0; n < (int)sizeof(regs); n += 2) {
+                    msx2->outPort(0x7C, regs[n]);
+                    msx2->outPort(0x7D, regs[n + 1]);
+                }
+            }
+            size_t size;
+            unsigned int h = 2166136261;
+            for (int frame = 0; frame < FRAME_COUNT; frame++) {
+                msx2->tick(0, 0, frame == FRAME_COUNT / 2 ? 'A' + i % 26 : 0);
+                const void* sound = msx2->getSound(&size);
+                h = hash(sound, size, h);
+            }
+            h = hash(msx2->getDisplay(), msx2->getDisplayWidth() * msx2->getDisplayHeight() * 2, h);
+            h = hash(msx2->mmu->ram, sizeof(msx2->mmu->ram), h);
+            result[i] = h;
+        });
+    }
+    auto start = std::chrono::system_clock::now();
+    batch.run();
+    auto end = std::chrono::system_clock::now();
+    return (int)std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+}
+
+int main()
+{
+    mainRom.data = loadFile("../../msx2-osx/bios/cbios_main_msx2+_jp.rom", &mainRom.size);
+    logoRom.data = loadFile("../../msx2-osx/bios/cbios_logo_msx2+.rom", &logoRom.size);
+    subRom.data = loadFile("../../msx2-osx/bios/cbios_sub.rom", &subRom.size);
+    if (!mainRom.data || !logoRom.data || !subRom.data) {
+        return -1;
+    }
+
+    unsigned int single[JOB_COUNT];
+    unsigned int multi[JOB_COUNT];
+    int singleTime = run(1, single);
+    int multiTime = run(0, multi);
+    printf("Jobs: %d x %d frames\n", JOB_COUNT, FRAME_COUNT);
+    printf("1 thread: %dms\n", singleTime);
+    printf("%d threads: %dms\n", MSX2Batch().getThreadCount(), multiTime);
+    int error = 0;
+    for (int i = 0; i < JOB_COUNT; i++) {
+        if (single[i] != multi[i]) {
+            printf("Job #%d: result mismatch (%08X != %08X)\n", i, single[i], multi[i]);
+            error++;
+        }
+    }
+    puts(error ? "FAILED" : "OK");
+
+    free(mainRom.data);
+    free(logoRom.data);
+    free(subRom.data);
+    return error ? -1 : 0;
+}
@@ -0,0 +1,789 @@
+/**
+ * V9958 Bitmap Renderer Tester
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#include "../../src/v9958.hpp"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_ROUNDS 5000
+#define BENCH_LINES 200000
+#define MODES 5
+
+static const struct {
+    const char* name;
+    unsigned char reg0;
+    bool yjk;
+} modes[MODES] = {
+    {"GRAPHIC4", 0b00000110, false},
+    {"GRAPHIC5", 0b00001000, false},
+    {"GRAPHIC6", 0b00001010, false},
+    {"GRAPHIC7", 0b00001110, false},
+    {"GRAPHIC7 (YJK)", 0b00001110, true},
+};
+
+static unsigned long long fnv(const void* data, size_t size, unsigned long long h = 14695981039346656037ULL)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        h ^= p[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+// Oracle: the scalar GRAPHIC4-7 background loops of the renderer before vectorization and the sprite loop (mode 2)
+// before the sprite cache (copied from the original V9958, with MSX2_DISPLAY_HALF_HORIZONTAL turned into HALF and
+// the VRAM reads masked to 0x1FFFF because the first read of a scanline could exceed the VRAM with SP2 scrolling)
+class BaselineRenderer
+{
+  private:
+    V9958* vdp;
+    int colorMode;
+    unsigned short yjkColor[32][64][64];
+
+    inline int min(int a, int b) { return a < b ? a : b; }
+    inline int max(int a, int b) { return a > b ? a : b; }
+
+    void initYjkColorTable()
+    {
+        for (int y = 0; y < 32; y++) {
+            for (int J = 0; J < 64; J++) {
+                for (int K = 0; K < 64; K++) {
+                    int j = (J & 0x1f) - (J & 0x20);
+                    int k = (K & 0x1f) - (K & 0x20);
+                    int r = 255 * (y + j) / 31;
+                    int g = 255 * (y + k) / 31;
+                    int b = 255 * ((5 * y - 2 * j - k) / 4) / 31;
+                    r = this->min(255, this->max(0, r));
+                    g = this->min(255, this->max(0, g));
+                    b = this->min(255, this->max(0, b));
+                    r = (r & 0b11111000) << (7 + colorMode);
+                    g = (g & 0b11111000) << (2 + colorMode);
+                    b = (b & 0b11111000) >> 3;
+                    this->yjkColor[y][J][K] = r | g | b;
+                }
+            }
+        }
+    }
+
+    inline void renderPixel1(unsigned short* renderPosition, int paletteNumber)
+    {
+        if (0 == (this->vdp->ctx.reg[8] & 0b00100000) && !paletteNumber) return;
+        *renderPosition = this->vdp->palette[paletteNumber];
+    }
+
+    inline void renderPixel2(unsigned short* renderPosition, int paletteNumber)
+    {
+        if (0 == (this->vdp->ctx.reg[8] & 0b00100000) && !paletteNumber) return;
+        *renderPosition = this->vdp->palette[paletteNumber];
+        *(renderPosition + 1) = this->vdp->palette[paletteNumber];
+    }
+
+    inline void renderPixelS2(unsigned short* renderPosition, int paletteNumber)
+    {
+        if (!paletteNumber || !this->vdp->isSpriteDisplay()) return;
+        *renderPosition = this->vdp->palette[paletteNumber];
+    }
+
+    inline void renderPixel2S2(unsigned short* renderPosition, int paletteNumber)
+    {
+        if (!paletteNumber || !this->vdp->isSpriteDisplay()) return;
+        *renderPosition = this->vdp->palette[paletteNumber];
+        *(renderPosition + 1) = this->vdp->palette[paletteNumber];
+    }
+
+    inline void set5S(bool f, int n)
+    {
+        this->vdp->ctx.stat[0] &= 0b11100000;
+        this->vdp->ctx.stat[0] |= (f ? 0b01000000 : 0) | (n & 0b00011111);
+    }
+
+    inline void setCollision(int x, int y)
+    {
+        this->vdp->ctx.stat[0] |= 0b00100000;
+        x += 12;
+        y += 8;
+        this->vdp->ctx.stat[3] = x & 0xFF;
+        this->vdp->ctx.stat[4] = (x & 0x0100) >> 8;
+        this->vdp->ctx.stat[5] = y & 0xFF;
+        this->vdp->ctx.stat[6] = (y & 0x0300) >> 8;
+    }
+
+    inline unsigned short bit2to5(unsigned short n)
+    {
+        n <<= 3;
+        n |= n & 0b01000 ? 1 : 0;
+        n |= n & 0b10000 ? 2 : 0;
+        n |= n & 0b11000 ? 4 : 0;
+        return n;
+    }
+
+    inline unsigned short bit3to5(unsigned short n)
+    {
+        n <<= 2;
+        n |= n & 0b01000 ? 1 : 0;
+        n |= n & 0b10000 ? 2 : 0;
+        return n;
+    }
+
+    inline unsigned short bit3to6(unsigned short n)
+    {
+        n <<= 3;
+        n |= n & 0b001000 ? 1 : 0;
+        n |= n & 0b010000 ? 2 : 0;
+        n |= n & 0b100000 ? 4 : 0;
+        return n;
+    }
+
+    inline unsigned short convertColor_8bit_to_16bit(unsigned char c)
+    {
+        unsigned short g = (c & 0b11100000) >> 5;
+        unsigned short r = (c & 0b00011100) >> 2;
+        unsigned short b = c & 0b00000011;
+        switch (this->colorMode) {
+            case 0: {
+                r = this->bit3to5(r) << 10;
+                g = this->bit3to5(g) << 5;
+                b = this->bit2to5(b);
+                return r | g | b;
+            }
+            case 1: {
+                r = this->bit3to5(r) << 11;
+                g = this->bit3to6(g) << 5;
+                b = this->bit2to5(b);
+                return r | g | b;
+            }
+            default: return 0;
+        }
+    }
+
+    template <bool HALF>
+    inline void renderScanlineModeG4(int lineNumber, unsigned short* renderPosition)
+    {
+        int curD = HALF ? (this->vdp->ctx.reg[27] & 0b00000111) / 2 : this->vdp->ctx.reg[27] & 0b00000111;
+        int addr = ((lineNumber + this->vdp->ctx.reg[23]) & 0xFF) * 128 + this->vdp->getNameTableAddress();
+        int addr2 = 0;
+        int sp2 = this->vdp->getSP2();
+        int x = this->vdp->ctx.reg[26];
+        if (sp2) {
+            x &= 0b00111111;
+            if (x < 32) {
+                addr2 = addr;
+                addr &= 0x17FFF;
+            } else {
+                addr |= 0x8000;
+                addr2 = addr & 0x17FFF;
+            }
+        } else {
+            x &= 0b00011111;
+        }
+        x <<= 2;
+        if (this->vdp->isEvenOrderMode() && addr & 0x8000) {
+            addr &= 0x17FFF;
+            addr |= (this->vdp->ctx.counter & 1) << 15;
+        }
+        for (int i = 0; i < 128; i++) {
+            if (HALF) {
+                this->renderPixel1(&renderPosition[curD++], (this->vdp->ctx.ram[(addr + x) & 0x1FFFF] & 0xF0) >> 4);
+                if (256 <= curD) break;
+                this->renderPixel1(&renderPosition[curD++], this->vdp->ctx.ram[(addr + x) & 0x1FFFF] & 0x0F);
+                if (256 <= curD) break;
+            } else {
+                this->renderPixel2(&renderPosition[curD], (this->vdp->ctx.ram[(addr + x) & 0x1FFFF] & 0xF0) >> 4);
+                curD += 2;
+                if (512 <= curD) break;
+                this->renderPixel2(&renderPosition[curD], this->vdp->ctx.ram[(addr + x) & 0x1FFFF] & 0x0F);
+                curD += 2;
+                if (512 <= curD) break;
+            }
+            x++;
+            x &= 0x7F;
+            if (0 == x && sp2) {
+                addr = addr2;
+            }
+        }
+    }
+
+    template <bool HALF>
+    inline void renderScanlineModeG5(int lineNumber, unsigned short* renderPosition)
+    {
+        int curD = HALF ? this->vdp->ctx.reg[27] & 0b00000111 : (this->vdp->ctx.reg[27] & 0b00000111) << 1;
+        int addr = ((lineNumber + this->vdp->ctx.reg[23]) & 0xFF) * 128 + this->vdp->getNameTableAddress();
+        int sp2 = this->vdp->getSP2();
+        int x = this->vdp->ctx.reg[26];
+        if (sp2) {
+            x &= 0b00111111;
+            if (x < 32) {
+                addr &= 0x17FFF;
+            } else {
+                addr |= 0x8000;
+            }
+        } else {
+            x &= 0b00011111;
+        }
+        x <<= 2;
+        for (int i = 0; i < 128; i++) {
+            addr &= 0x1FFFF;
+            if (HALF) {
+                this->renderPixel1(&renderPosition[curD++], (this->vdp->ctx.ram[(addr + x) & 0x1FFFF] & 0xC0) >> 6);
+                if (256 <= curD) break;
+                this->renderPixel1(&renderPosition[curD++], (this->vdp->ctx.ram[(addr + x) & 0x1FFFF] & 0x0C) >> 2);
+                if (256 <= curD) break;
+            } else {
+                this->renderPixel1(&renderPosition[curD++], (this->vdp->ctx.ram[(addr + x) & 0x1FFFF] & 0xC0) >> 6);
+                if (512 <= curD) break;
+                this->renderPixel1(&renderPosition[curD++], (this->vdp->ctx.ram[(addr + x) & 0x1FFFF] & 0x30) >> 4);
+                if (512 <= curD) break;
+                this->renderPixel1(&renderPosition[curD++], (this->vdp->ctx.ram[(addr + x) & 0x1FFFF] & 0x0C) >> 2);
+                if (512 <= curD) break;
+                this->renderPixel1(&renderPosition[curD++], this->vdp->ctx.ram[(addr + x) & 0x1FFFF] & 0x03);
+                if (512 <= curD) break;
+            }
+            x++;
+            x &= 0x7F;
+            if (0 == x && sp2) {
+                addr ^= 0x8000;
+            }
+        }
+    }
+
+    template <bool HALF>
+    inline void renderScanlineModeG6(int lineNumber, unsigned short* renderPosition)
+    {
+        int curD = HALF ? this->vdp->ctx.reg[27] & 0b00000111 : (this->vdp->ctx.reg[27] & 0b00000111) << 1;
+        int addr = ((lineNumber + this->vdp->ctx.reg[23]) & 0xFF) * 256 + this->vdp->getNameTableAddress();
+        int sp2 = this->vdp->getSP2();
+        int x = this->vdp->ctx.reg[26];
+        if (this->vdp->isEvenOrderMode() && addr & 0x10000) {
+            addr &= 0xFFFF;
+            addr |= (this->vdp->ctx.counter & 1) << 16;
+        }
+        if (sp2) {
+            x &= 0b00111111;
+            if (x < 32) {
+                addr &= 0x0FFFF;
+            } else {
+                addr |= 0x10000;
+            }
+        } else {
+            x &= 0b00011111;
+        }
+        x <<= 3;
+        for (int i = 0; i < 256 && curD < (HALF ? 256 : 512); i++) {
+            this->renderPixel1(&renderPosition[curD++], (this->vdp->ctx.ram[(addr + x) & 0x1FFFF] & 0xF0) >> 4);
+            if (!HALF) {
+                this->renderPixel1(&renderPosition[curD++], this->vdp->ctx.ram[(addr + x) & 0x1FFFF] & 0x0F);
+            }
+            x++;
+            x &= 0xFF;
+            addr ^= 0 == x && sp2 ? 0x10000 : 0;
+        }
+    }
+
+    template <bool HALF>
+    inline void renderScanlineModeG7(int lineNumber, unsigned short* renderPosition)
+    {
+        int curD = 0;
+        int curP = ((lineNumber + this->vdp->ctx.reg[23]) & 0xFF) * 256;
+        curP += this->vdp->getNameTableAddress();
+        if (this->vdp->isYJK()) {
+            for (int i = 0; i < 256; i += 4) {
+                unsigned char y[4];
+                y[0] = this->vdp->ctx.ram[curP++];
+                y[1] = this->vdp->ctx.ram[curP++];
+                y[2] = this->vdp->ctx.ram[curP++];
+                y[3] = this->vdp->ctx.ram[curP++];
+                unsigned char k = (y[1] & 0b00000111) << 3;
+                k |= y[0] & 0b00000111;
+                unsigned char j = (y[3] & 0b00000111) << 3;
+                j |= y[2] & 0b00000111;
+                for (int n = 0; n < 4; n++) {
+                    y[n] &= 0b11111000;
+                    y[n] >>= 3;
+                    if (this->vdp->isYAE() && (y[n] & 1)) {
+                        renderPosition[curD] = this->vdp->palette[(y[n] >> 1) & 0x0F];
+                    } else {
+                        renderPosition[curD] = this->yjkColor[y[n]][j][k];
+                    }
+                    if (HALF) {
+                        curD++;
+                    } else {
+                        renderPosition[curD + 1] = renderPosition[curD];
+                        curD += 2;
+                    }
+                }
+            }
+        } else {
+            for (int i = 0; i < 256; i++) {
+                renderPosition[curD] = convertColor_8bit_to_16bit(this->vdp->ctx.ram[curP++]);
+                if (HALF) {
+                    curD++;
+                } else {
+                    renderPosition[curD + 1] = renderPosition[curD];
+                    curD += 2;
+                }
+            }
+        }
+    }
+
+    template <bool HALF>
+    inline void renderSpritesMode2(int lineNumber, unsigned short* renderPosition)
+    {
+        static const unsigned char bit[8] = {
+            0b10000000,
+            0b01000000,
+            0b00100000,
+            0b00010000,
+            0b00001000,
+            0b00000100,
+            0b00000010,
+            0b00000001};
+        int si = this->vdp->isSprite16px() ? 16 : 8;
+        int mag = this->vdp->isSprite2x() ? 2 : 1;
+        int sa = this->vdp->getSpriteAttributeTableM2();
+        int ct = this->vdp->getSpriteColorTable();
+        int sg = this->vdp->getSpriteGeneratorTable();
+        int sn = 0;
+        int tsn = 0;
+        unsigned char paletteMask = this->vdp->getScreenMode() == 0b00100 ? 0x03 : 0x0F;
+        unsigned char dlog[256];
+        unsigned char wlog[256];
+        unsigned char skip[256];
+        memset(dlog, 0, sizeof(dlog));
+        memset(wlog, 0, sizeof(wlog));
+        memset(skip, 0, sizeof(skip));
+        bool limitOver = false;
+        for (int i = 0; i < 32; i++, ct += 16) {
+            int cur = sa + i * 4;
+            unsigned char y = this->vdp->ctx.ram[cur++];
+            if (216 == y) break;
+            int x = this->vdp->ctx.ram[cur++];
+            unsigned char ptn = this->vdp->ctx.ram[cur++];
+            y += 1 - this->vdp->ctx.reg[23];
+            if (y <= lineNumber && lineNumber < y + si * mag) {
+                sn++;
+                int pixelLine = lineNumber - y;
+                unsigned char col = this->vdp->ctx.ram[ct + pixelLine / mag];
+                bool ic = col & 0x20;
+                bool cc = col & 0x40;
+                if (col & 0x80) x -= 32;
+                col &= paletteMask;
+                if (!col) tsn++;
+                if (9 == sn) {
+                    this->set5S(true, i);
+                    if (!this->vdp->renderLimitOverSprites) {
+                        break;
+                    } else {
+                        if (8 <= tsn) break;
+                        limitOver = true;
+                    }
+                } else if (sn < 9) {
+                    this->set5S(false, i);
+                }
+                if (16 == si) {
+                    cur = sg + (ptn & 252) * 8 + pixelLine % (8 * mag) / mag + (pixelLine < 8 * mag ? 0 : 8);
+                } else {
+                    cur = sg + ptn * 8 + lineNumber % (8 * mag) / mag;
+                }
+                for (int j = 0; x < 256 && j < 8 * mag; j++, x++) {
+                    if (x < 0) continue;
+                    if (dlog[x] && !limitOver && !ic) {
+                        this->setCollision(x, lineNumber);
+                    }
+                    if (0 == wlog[x] || cc) {
+                        if (this->vdp->ctx.ram[cur] & bit[j / mag]) {
+                            if (cc) {
+                                if (!skip[x]) {
+                                    if (renderPosition) {
+                                        if (HALF) {
+                                            this->renderPixelS2(&renderPosition[x], dlog[x] | col);
+                                        } else {
+                                            this->renderPixel2S2(&renderPosition[x << 1], dlog[x] | col);
+                                        }
+                                    }
+                                }
+                            } else {
+                                if (renderPosition) {
+                                    if (HALF) {
+                                        this->renderPixelS2(&renderPosition[x], col);
+                                    } else {
+                                        this->renderPixel2S2(&renderPosition[x << 1], col);
+                                    }
+                                }
+                                dlog[x] = col;
+                            }
+                            wlog[x] = 1;
+                        }
+                    } else {
+                        skip[x] = 1;
+                    }
+                }
+                if (16 == si) {
+                    cur += 16;
+                    for (int j = 0; x < 256 && j < 8 * mag; j++, x++) {
+                        if (x < 0) continue;
+                        if (dlog[x] && !limitOver && !ic) {
+                            this->setCollision(x, lineNumber);
+                        }
+                        if (0 == wlog[x] || cc) {
+                            if (this->vdp->ctx.ram[cur] & bit[j / mag]) {
+                                if (cc) {
+                                    if (!skip[x]) {
+                                        if (renderPosition) {
+                                            if (HALF) {
+                                                this->renderPixelS2(&renderPosition[x], dlog[x] | col);
+                                            } else {
+                                                this->renderPixel2S2(&renderPosition[x << 1], dlog[x] | col);
+                                            }
+                                        }
+                                    }
+                                } else {
+                                    if (renderPosition) {
+                                        if (HALF) {
+                                            this->renderPixelS2(&renderPosition[x], col);
+                                        } else {
+                                            this->renderPixel2S2(&renderPosition[x << 1], col);
+                                        }
+                                    }
+                                    dlog[x] = col;
+                                }
+                                wlog[x] = 1;
+                            }
+                        } else {
+                            skip[x] = 1;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+  public:
+    BaselineRenderer(V9958* vdp, int colorMode)
+    {
+        this->vdp = vdp;
+        this->colorMode = colorMode;
+        this->initYjkColorTable();
+    }
+
+    // renders the background and the sprites of the scanline (S#0 and the collision coordinates are updated)
+    template <bool HALF>
+    void renderScanline(int lineNumber, unsigned short* renderPosition)
+    {
+        if (lineNumber < 0 || this->vdp->getLineNumber() <= lineNumber || !this->vdp->isEnabledScreen()) {
+            return;
+        }
+        switch (this->vdp->getScreenMode()) {
+            case 0b00011: this->renderScanlineModeG4<HALF>(lineNumber, renderPosition); break;
+            case 0b00100: this->renderScanlineModeG5<HALF>(lineNumber, renderPosition); break;
+            case 0b00101: this->renderScanlineModeG6<HALF>(lineNumber, renderPosition); break;
+            case 0b00111: this->renderScanlineModeG7<HALF>(lineNumber, renderPosition); break;
+        }
+        this->renderSpritesMode2<HALF>(lineNumber, renderPosition);
+        if (this->vdp->isMaskLeft8px()) {
+            for (int i = 0; i < (HALF ? 8 : 16); i++) {
+                renderPosition[i] = this->vdp->getBackdropColor();
+            }
+        }
+    }
+};
+
+static void setupRandom(V9958* vdp, int mode)
+{
+    for (int i = 0; i < (int)sizeof(vdp->ctx.ram); i++) {
+        vdp->ctx.ram[i] = (unsigned char)rand();
+    }
+    for (int i = 0; i < 64; i++) {
+        vdp->ctx.reg[i] = (unsigned char)rand();
+    }
+    vdp->ctx.reg[0] = modes[mode].reg0;
+    vdp->ctx.reg[1] = 0b01000000 | (rand() & 0b00000011);
+    vdp->ctx.reg[25] = modes[mode].yjk ? vdp->ctx.reg[25] | 0b00001000 : vdp->ctx.reg[25] & 0b11110111;
+    vdp->ctx.counter = rand();
+    for (int i = 0; i < 16; i++) {
+        vdp->ctx.pal[i][0] = (unsigned char)rand();
+        vdp->ctx.pal[i][1] = (unsigned char)rand();
+        vdp->updatePaletteCacheFromRegister(i);
+    }
+    vdp->resetSpriteCache();
+}
+
+static void writeRegister(V9958* vdp, int rn, unsigned char value)
+{
+    vdp->outPort99(value);
+    vdp->outPort99(0x80 | rn);
+}
+
+static void writeVRAM(V9958* vdp, int addr, unsigned char value)
+{
+    writeRegister(vdp, 14, (unsigned char)(addr >> 14));
+    vdp->outPort99((unsigned char)(addr & 0xFF));
+    vdp->outPort99((unsigned char)(0x40 | ((addr >> 8) & 0x3F)));
+    vdp->outPort98(value);
+}
+
+// place the sprites around the random band (many sprites on a scanline) or the random lines and the end mark (216)
+static void setupRandomSprites(V9958* vdp)
+{
+    int sa = vdp->getSpriteAttributeTableM2();
+    int band = rand() % 212;
+    for (int i = 0; i < 32; i++) {
+        int y = rand() % 2 ? band + rand() % 16 : rand() % 256;
+        vdp->ctx.ram[sa + i * 4] = (unsigned char)(y - 1 + vdp->ctx.reg[23]);
+    }
+    if (rand() % 2) {
+        vdp->ctx.ram[sa + rand() % 32 * 4] = 216;
+    }
+    vdp->resetSpriteCache();
+}
+
+// change the sprite tables or the registers that affect the sprites through the ports (the sprite cache must be invalidated)
+static void changeRandomSprites(V9958* vdp)
+{
+    switch (rand() % 8) {
+        case 0: writeVRAM(vdp, vdp->getSpriteAttributeTableM2() + rand() % 128, (unsigned char)rand()); break;
+        case 1: writeVRAM(vdp, vdp->getSpriteAttributeTableM2() + rand() % 32 * 4, (unsigned char)(rand() % 212 - 1 + vdp->ctx.reg[23])); break;
+        case 2: writeVRAM(vdp, vdp->getSpriteColorTable() + rand() % 512, (unsigned char)rand()); break;
+        case 3: writeVRAM(vdp, vdp->getSpriteGeneratorTable() + rand() % 2048, (unsigned char)rand()); break;
+        case 4: writeRegister(vdp, rand() % 2 ? 5 : 11, (unsigned char)rand()); break;
+        case 5: writeRegister(vdp, 6, (unsigned char)rand()); break;
+        case 6: writeRegister(vdp, 1, (unsigned char)(0b01000000 | (rand() & 0b00000011))); break;
+        default: writeRegister(vdp, rand() % 2 ? 8 : 23, (unsigned char)rand()); break;
+    }
+}
+
+// render the scanline with V9958 and the oracle from the same status and compare the pixels and the status
+static bool compareScanline(V9958* vdp, BaselineRenderer* baseline, bool half, int lineNumber)
+{
+    static unsigned short actual[568];
+    static unsigned short expect[568];
+    unsigned char stat[16];
+    unsigned char actualStat[16];
+    for (int i = 0; i < 568; i++) {
+        actual[i] = expect[i] = (unsigned short)rand();
+    }
+    memcpy(stat, vdp->ctx.stat, sizeof(stat));
+    if (half) {
+        int offset = 13 - vdp->getAdjustX();
+        vdp->renderScanline<true>(lineNumber, &actual[offset]);
+        memcpy(actualStat, vdp->ctx.stat, sizeof(actualStat));
+        memcpy(vdp->ctx.stat, stat, sizeof(stat));
+        baseline->renderScanline<true>(lineNumber, &expect[offset]);
+    } else {
+        int offset = 26 - (vdp->getAdjustX() << 1);
+        vdp->renderScanline<false>(lineNumber, &actual[offset]);
+        memcpy(actualStat, vdp->ctx.stat, sizeof(actualStat));
+        memcpy(vdp->ctx.stat, stat, sizeof(stat));
+        baseline->renderScanline<false>(lineNumber, &expect[offset]);
+    }
+    return 0 == memcmp(actual, expect, sizeof(actual)) && 0 == memcmp(actualStat, vdp->ctx.stat, sizeof(actualStat));
+}
+
+static unsigned long long renderRandomLine(V9958* vdp, bool half)
+{
+    static unsigned short line[568];
+    for (int i = 0; i < 568; i++) {
+        line[i] = (unsigned short)rand(); // backdrop (kept on the transparent pixels)
+    }
+    int lineNumber = rand() % vdp->getLineNumber();
+    if (half) {
+        vdp->renderScanline<true>(lineNumber, &line[13 - vdp->getAdjustX()]);
+    } else {
+        vdp->renderScanline<false>(lineNumber, &line[26 - (vdp->getAdjustX() << 1)]);
+    }
+    return fnv(vdp->ctx.stat, sizeof(vdp->ctx.stat), fnv(line, sizeof(line)));
+}
+
+int main(int argc, char* argv[])
+{
+    static V9958 vdp;
+    static unsigned long long hash[2][MODES][2][TEST_ROUNDS];
+    if (argc < 2) {
+        puts("usage: test {record|verify} expect.bin");
+        return 1;
+    }
+    bool record = 0 == strcmp(argv[1], "record");
+    const char* path = 2 < argc ? argv[2] : "expect.bin";
+#if defined(V9958_SIMD_AVX2)
+    puts("Renderer: AVX2");
+#elif defined(V9958_SIMD_SSSE3)
+    puts("Renderer: SSSE3");
+#elif defined(V9958_SIMD_NEON)
+    puts("Renderer: NEON");
+#else
+    puts("Renderer: scalar");
+#endif
+
+    // compare the background (sprites disabled) with the original scalar renderer
+    srand(1);
+    for (int colorMode = 0; colorMode < 2; colorMode++) {
+        vdp.initialize(colorMode, nullptr, [](void*, int) {}, [](void*) {}, [](void*) {});
+        BaselineRenderer* baseline = new BaselineRenderer(&vdp, colorMode);
+        for (int mode = 0; mode < MODES; mode++) {
+            for (int half = 0; half < 2; half++) {
+                for (int round = 0; round < TEST_ROUNDS; round++) {
+                    if (0 == round % 100) {
+                        setupRandom(&vdp, mode);
+                    } else {
+                        for (int i = 0; i < 4; i++) {
+                            vdp.ctx.reg[rand() % 2 ? 8 : 18 + rand() % 10] = (unsigned char)rand();
+                        }
+                        vdp.ctx.reg[25] = modes[mode].yjk ? vdp.ctx.reg[25] | 0b00001000 : vdp.ctx.reg[25] & 0b11110111;
+                    }
+                    vdp.ctx.reg[8] |= 0b00000010; // sprite disable
+                    vdp.resetSpriteCache();
+                    if (!compareScanline(&vdp, baseline, half, rand() % vdp.getLineNumber())) {
+                        printf("FAILED: differs from the original renderer (%s, colorMode=%d, %s, round %d)\n", modes[mode].name, colorMode, half ? "half" : "full", round);
+                        return -1;
+                    }
+                }
+            }
+        }
+        delete baseline;
+    }
+    printf("Original renderer: OK (%d rounds)\n", TEST_ROUNDS);
+
+    // compare the sprites, S#0 and the collision coordinates with the original renderer while the sprite tables and
+    // the sprite registers are changed through the ports between the scanlines (the sprite cache must follow them)
+    srand(2);
+    for (int colorMode = 0; colorMode < 2; colorMode++) {
+        vdp.initialize(colorMode, nullptr, [](void*, int) {}, [](void*) {}, [](void*) {});
+        BaselineRenderer* baseline = new BaselineRenderer(&vdp, colorMode);
+        for (int mode = 0; mode < MODES; mode++) {
+            for (int half = 0; half < 2; half++) {
+                for (int round = 0; round < TEST_ROUNDS; round++) {
+                    if (0 == round % 100) {
+                        setupRandom(&vdp, mode);
+                        vdp.ctx.reg[8] &= 0b11111101; // sprite enable
+                        setupRandomSprites(&vdp);
+                    } else {
+                        for (int i = rand() % 4; 0 < i; i--) {
+                            changeRandomSprites(&vdp);
+                        }
+                    }
+                    vdp.renderLimitOverSprites = 0 != rand() % 4;
+                    if (!compareScanline(&vdp, baseline, half, rand() % vdp.getLineNumber())) {
+                        printf("FAILED: differs from the original sprite renderer (%s, colorMode=%d, %s, round %d)\n", modes[mode].name, colorMode, half ? "half" : "full", round);
+                        return -1;
+                    }
+                }
+            }
+        }
+        delete baseline;
+    }
+    vdp.renderLimitOverSprites = true;
+    printf("Original sprite renderer: OK (%d rounds)\n", TEST_ROUNDS);
+
+    // render random scanlines in every color mode, screen mode and width
+    srand(0);
+    for (int colorMode = 0; colorMode < 2; colorMode++) {
+        vdp.initialize(colorMode, nullptr, [](void*, int) {}, [](void*) {}, [](void*) {});
+        for (int mode = 0; mode < MODES; mode++) {
+            for (int half = 0; half < 2; half++) {
+                for (int round = 0; round < TEST_ROUNDS; round++) {
+                    if (0 == round % 100) {
+                        setupRandom(&vdp, mode);
+                    } else {
+                        for (int i = 0; i < 4; i++) {
+                            vdp.ctx.reg[rand() % 2 ? 8 : 18 + rand() % 10] = (unsigned char)rand();
+                        }
+                        vdp.ctx.reg[25] = modes[mode].yjk ? vdp.ctx.reg[25] | 0b00001000 : vdp.ctx.reg[25] & 0b11110111;
+                        vdp.resetSpriteCache();
+                    }
+                    hash[colorMode][mode][half][round] = renderRandomLine(&vdp, half);
+                }
+            }
+        }
+    }
+
+    // record (scalar renderer) or verify (SIMD renderer) the result
+    FILE* fp = fopen(path, record ? "wb" : "rb");
+    if (!fp) {
+        printf("cannot open %s\n", path);
+        return -1;
+    }
+    if (record) {
+        fwrite(hash, 1, sizeof(hash), fp);
+        fclose(fp);
+        printf("Recorded: %s (%d rounds)\n", path, TEST_ROUNDS);
+    } else {
+        static unsigned long long expect[2][MODES][2][TEST_ROUNDS];
+        size_t readSize = fread(expect, 1, sizeof(expect), fp);
+        fclose(fp);
+        if (readSize != sizeof(expect)) {
+            printf("invalid %s\n", path);
+            return -1;
+        }
+        for (int colorMode = 0; colorMode < 2; colorMode++) {
+            for (int mode = 0; mode < MODES; mode++) {
+                for (int half = 0; half < 2; half++) {
+                    for (int round = 0; round < TEST_ROUNDS; round++) {
+                        if (hash[colorMode][mode][half][round] != expect[colorMode][mode][half][round]) {
+                            printf("FAILED (%s, colorMode=%d, %s, round %d)\n", modes[mode].name, colorMode, half ? "half" : "full", round);
+                            return -1;
+                        }
+                    }
+                }
+            }
+        }
+        printf("Pixel-exact: OK (%d rounds)\n", TEST_ROUNDS);
+    }
+
+    // measure the time to render the scanlines of each screen mode (without sprites)
+    vdp.initialize(0, nullptr, [](void*, int) {}, [](void*) {}, [](void*) {});
+    for (int mode = 0; mode < MODES; mode++) {
+        setupRandom(&vdp, mode);
+        vdp.ctx.ram[vdp.getSpriteAttributeTableM2()] = 216;
+        static unsigned short line[568];
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < BENCH_LINES; i++) {
+            vdp.renderScanline<false>(i % 192, &line[26]);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        printf("%s: %lldms (%d lines)\n", modes[mode].name, (long long)std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count(), BENCH_LINES);
+    }
+
+    // measure the time to render the sprites (32 sprites of 16x16 pixels in GRAPHIC4)
+    setupRandom(&vdp, 0);
+    vdp.ctx.reg[1] = (vdp.ctx.reg[1] & 0b11111100) | 0b00000010;
+    vdp.ctx.reg[8] &= 0b11111101;
+    vdp.ctx.reg[23] = 0;
+    for (int i = 0; i < 32; i++) {
+        vdp.ctx.ram[vdp.getSpriteAttributeTableM2() + i * 4] = (unsigned char)(rand() % 192);
+    }
+    vdp.resetSpriteCache();
+    {
+        static unsigned short line[568];
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < BENCH_LINES; i++) {
+            vdp.renderScanline<false>(i % 192, &line[26]);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        printf("GRAPHIC4 (sprites): %lldms (%d lines)\n", (long long)std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count(), BENCH_LINES);
+    }
+    return 0;
+}
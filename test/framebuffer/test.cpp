@@ -0,0 +1,176 @@
+/**
+ * Frame Buffer Output Tester
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#include "../../src/msx2.hpp"
+#include "../../src/msx2scaler.hpp"
+
+void* loadFile(const char* path, size_t* size)
+{
+    FILE* fp = fopen(path, "rb");
+    if (!fp) {
+        printf("File not found: %s\n", path);
+        return nullptr;
+    }
+    fseek(fp, 0, SEEK_END);
+    *size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    void* result = malloc(*size);
+    if (!result) {
+        puts("No memory");
+        fclose(fp);
+        return nullptr;
+    }
+    if (*size != fread(result, 1, *size, fp)) {
+        printf("Read error: %s\n", path);
+        fclose(fp);
+        free(result);
+        return nullptr;
+    }
+    fclose(fp);
+    return result;
+}
+
+struct Rom {
+    void* data;
+    size_t size;
+} mainRom, logoRom, subRom;
+
+void setup(MSX2* msx2)
+{
+    msx2->setupSecondaryExist(false, false, false, true);
+    msx2->setup(0, 0, 0, mainRom.data, (int)mainRom.size, "MAIN");
+    msx2->setup(0, 0, 4, logoRom.data, (int)logoRom.size, "LOGO");
+    msx2->setup(3, 0, 0, subRom.data, (int)subRom.size, "SUB");
+    msx2->setupRAM(3, 3);
+    msx2->reset();
+}
+
+static const char* formatNames[4] = {"RGB555", "RGB565", "XRGB8888", "RGBA8888"};
+
+// expected output pixel of the display pixel (an independent implementation of the conversion)
+unsigned int expectPixel(int colorMode, unsigned short c, int format)
+{
+    // expand to 8 bits per component by repeating the upper bits to the lower bits
+    unsigned int r = (c >> (MSX2_COLOR_MODE_RGB565 == colorMode ? 11 : 10)) & 0x1F;
+    unsigned int g = MSX2_COLOR_MODE_RGB565 == colorMode ? (c >> 5) & 0x3F : (c >> 5) & 0x1F;
+    unsigned int b = c & 0x1F;
+    r = r << 3 | r >> 2;
+    g = MSX2_COLOR_MODE_RGB565 == colorMode ? g << 2 | g >> 4 : g << 3 | g >> 2;
+    b = b << 3 | b >> 2;
+    switch (format) {
+        case MSX2_PIXEL_FORMAT_RGB555: return (r >> 3) << 10 | (g >> 3) << 5 | b >> 3;
+        case MSX2_PIXEL_FORMAT_RGB565: return (r >> 3) << 11 | (g >> 2) << 5 | b >> 3;
+        case MSX2_PIXEL_FORMAT_XRGB8888: return 0xFF000000 | r << 16 | g << 8 | b;
+        default: return r << 24 | g << 16 | b << 8 | 0xFF;
+    }
+}
+
+// check the frame buffer scaled by MSX2Scaler in every scale (1x-3x) and returns the number of mismatched pixels
+int checkScaler(const unsigned char* top, int width, int height, int pitch)
+{
+    static unsigned int scaled[568 * 3 * 240 * 3];
+    int mismatch = 0;
+    for (int scaleX = 1; scaleX <= 3; scaleX++) {
+        for (int scaleY = 1; scaleY <= 3; scaleY++) {
+            int scaledWidth = width * scaleX;
+            MSX2Scaler::render(top, width, height, pitch, scaled, scaledWidth * 4, scaleX, scaleY);
+            for (int y = 0; y < height * scaleY; y++) {
+                const unsigned int* line = (const unsigned int*)(top + y / scaleY * pitch);
+                for (int x = 0; x < scaledWidth; x++) {
+                    mismatch += scaled[y * scaledWidth + x] != line[x / scaleX] ? 1 : 0;
+                }
+            }
+        }
+    }
+    return mismatch;
+}
+
+int main()
+{
+    mainRom.data = loadFile("../../msx2-osx/bios/cbios_main_msx2+_jp.rom", &mainRom.size);
+    logoRom.data = loadFile("../../msx2-osx/bios/cbios_logo_msx2+.rom", &logoRom.size);
+    subRom.data = loadFile("../../msx2-osx/bios/cbios_sub.rom", &subRom.size);
+    if (!mainRom.data || !logoRom.data || !subRom.data) {
+        return -1;
+    }
+
+    static unsigned char frameBuffer[568 * 240 * 4];
+    int error = 0;
+    srand(0);
+    for (int colorMode = 0; colorMode < 2; colorMode++) {
+        MSX2 msx2(colorMode);
+        setup(&msx2);
+        for (int i = 0; i < 150; i++) {
+            msx2.tick(0, 0, 0);
+        }
+        for (int half = 0; half < 2; half++) {
+            msx2.setHalfHorizontal(half ? true : false);
+            for (int format = 0; format < 4; format++) {
+                for (int bottomUp = 0; bottomUp < 2; bottomUp++) {
+                    int width = msx2.getDisplayWidth();
+                    int height = msx2.getDisplayHeight();
+                    int bpp = format < 2 ? 2 : 4;
+                    int pitch = bottomUp ? -width * bpp : width * bpp;
+                    unsigned char* top = bottomUp ? &frameBuffer[(height - 1) * width * bpp] : frameBuffer;
+                    for (int i = 0; i < 16; i++) {
+                        msx2.vdp->ctx.pal[i][0] = (unsigned char)rand(); // random colors to cover more component values
+                        msx2.vdp->ctx.pal[i][1] = (unsigned char)rand();
+                        msx2.vdp->updatePaletteCacheFromRegister(i);
+                    }
+                    memset(frameBuffer, 0xCC, sizeof(frameBuffer));
+                    msx2.setFrameBuffer(top, pitch, format);
+                    msx2.tick(0, 0, 0);
+                    msx2.setFrameBuffer(nullptr, 0, 0);
+                    const unsigned short* display = msx2.getDisplay();
+                    int mismatch = 0;
+                    for (int y = 0; y < height; y++) {
+                        const unsigned char* line = top + y * pitch;
+                        for (int x = 0; x < width; x++) {
+                            unsigned int actual = 2 == bpp ? ((const unsigned short*)line)[x] : ((const unsigned int*)line)[x];
+                            if (actual != expectPixel(colorMode, display[y * width + x], format)) {
+                                mismatch++;
+                            }
+                        }
+                    }
+                    if (2 < bpp) {
+                        mismatch += checkScaler(top, width, height, pitch);
+                    }
+                    printf("colorMode=%d, %s, %s, %s: %s\n", colorMode, half ? "half" : "full", formatNames[format], bottomUp ? "bottom-up" : "top-down", mismatch ? "FAILED" : "OK");
+                    if (mismatch) {
+                        printf("- %d pixels mismatch\n", mismatch);
+                        error++;
+                    }
+                }
+            }
+        }
+    }
+    puts(error ? "FAILED" : "OK");
+
+    free(mainRom.data);
+    free(logoRom.data);
+    free(subRom.data);
+    return error ? -1 : 0;
+}
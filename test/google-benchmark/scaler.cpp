@@ -0,0 +1,104 @@
+/**
+ * Performance Tester with Google Benchmark (frame buffer output and integer scaling)
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#include "benchmark/benchmark.h"
+#include "msx2def.h"
+#include "msx2scaler.hpp"
+#include "v9958.hpp"
+#include <stdlib.h>
+
+#define DISPLAY_WIDTH 568
+#define DISPLAY_HEIGHT 240
+
+static V9958 vdp;
+static unsigned int frame[DISPLAY_WIDTH * DISPLAY_HEIGHT];
+static unsigned int screen[DISPLAY_WIDTH * DISPLAY_HEIGHT * 9];
+
+static inline unsigned char bit5To8(unsigned char c)
+{
+    return c << 3 | c >> 2;
+}
+
+static void setupDisplay()
+{
+    vdp.initialize(MSX2_COLOR_MODE_RGB555, nullptr, [](void*, int) {}, [](void*) {}, [](void*) {});
+    for (int i = 0; i < DISPLAY_WIDTH * DISPLAY_HEIGHT; i++) {
+        vdp.display[i] = rand() & 0x7FFF;
+    }
+}
+
+// per-pixel conversion and line duplication (the former implementation of the front ends)
+static void ScalerPerPixel2x(benchmark::State& state)
+{
+    setupDisplay();
+    for (auto _ : state) {
+        for (int y = 0; y < DISPLAY_HEIGHT; y++) {
+            unsigned int* line = &screen[y * 2 * DISPLAY_WIDTH];
+            for (int x = 0; x < DISPLAY_WIDTH; x++) {
+                unsigned short c = vdp.display[y * DISPLAY_WIDTH + x];
+                line[x] = 0xFF000000 | bit5To8((c >> 10) & 0x1F) << 16 | bit5To8((c >> 5) & 0x1F) << 8 | bit5To8(c & 0x1F);
+            }
+            memcpy(&line[DISPLAY_WIDTH], line, DISPLAY_WIDTH * 4);
+        }
+        benchmark::DoNotOptimize(screen);
+    }
+}
+
+// conversion of the rendered scanlines to the frame buffer specified by setFrameBuffer (XRGB8888)
+static void FrameBufferOutput(benchmark::State& state)
+{
+    setupDisplay();
+    vdp.setOutputBuffer(frame, DISPLAY_WIDTH * 4, MSX2_PIXEL_FORMAT_XRGB8888);
+    for (auto _ : state) {
+        for (int y = 0; y < DISPLAY_HEIGHT; y++) {
+            vdp.outputScanline(y);
+        }
+        benchmark::DoNotOptimize(frame);
+    }
+}
+
+static void ScalerRender(benchmark::State& state)
+{
+    int scale = (int)state.range(0);
+    for (auto _ : state) {
+        MSX2Scaler::render(frame, DISPLAY_WIDTH, DISPLAY_HEIGHT, DISPLAY_WIDTH * 4, screen, DISPLAY_WIDTH * scale * 4, scale, scale);
+        benchmark::DoNotOptimize(screen);
+    }
+}
+
+static void ScalerRender1x2(benchmark::State& state)
+{
+    for (auto _ : state) {
+        MSX2Scaler::render(frame, DISPLAY_WIDTH, DISPLAY_HEIGHT, DISPLAY_WIDTH * 4, screen, DISPLAY_WIDTH * 4, 1, 2);
+        benchmark::DoNotOptimize(screen);
+    }
+}
+
+BENCHMARK(ScalerPerPixel2x);
+BENCHMARK(FrameBufferOutput);
+BENCHMARK(ScalerRender1x2);
+BENCHMARK(ScalerRender)->Arg(1)->Arg(2)->Arg(3);
+BENCHMARK_MAIN();
@@ -0,0 +1,138 @@
+/**
+ * Performance Tester with Google Benchmark (Z80 callback vs template bus)
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#include "benchmark/benchmark.h"
+#include "msx2.hpp"
+
+#define CLOCKS_PER_FRAME (3584160 / 60)
+
+static void* loadFile(const char* path, size_t* size)
+{
+    FILE* fp = fopen(path, "rb");
+    if (!fp) {
+        printf("File not found: %s\n", path);
+        exit(-1);
+    }
+    fseek(fp, 0, SEEK_END);
+    *size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    void* result = malloc(*size);
+    if (!result || *size != fread(result, 1, *size, fp)) {
+        printf("Read error: %s\n", path);
+        exit(-1);
+    }
+    fclose(fp);
+    return result;
+}
+
+// LDIR (256 bytes) + IN/OUT loop (256 times) in the main RAM through the MSX2 memory mapper and VDP ports
+static const unsigned char program[] = {
+    0x21, 0x00, 0xC1, // $C000: LD HL, $C100
+    0x11, 0x00, 0xD0, // $C003: LD DE, $D000
+    0x01, 0x00, 0x01, // $C006: LD BC, $0100
+    0xED, 0xB0,       // $C009: LDIR
+    0x06, 0x00,       // $C00B: LD B, 0
+    0xDB, 0x99,       // $C00D: IN A, ($99)
+    0xD3, 0x98,       // $C00F: OUT ($98), A
+    0x10, 0xFA,       // $C011: DJNZ $C00D
+    0xC3, 0x00, 0xC0, // $C013: JP $C000
+};
+
+class MSX2Fixture
+{
+  private:
+    void* main;
+    void* logo;
+    void* sub;
+
+  public:
+    MSX2 msx2;
+
+    MSX2Fixture() : msx2(MSX2_COLOR_MODE_RGB555)
+    {
+        size_t mainSize, logoSize, subSize;
+        main = loadFile("../../msx2-osx/bios/cbios_main_msx2+_jp.rom", &mainSize);
+        logo = loadFile("../../msx2-osx/bios/cbios_logo_msx2+.rom", &logoSize);
+        sub = loadFile("../../msx2-osx/bios/cbios_sub.rom", &subSize);
+        msx2.setupSecondaryExist(false, false, false, true);
+        msx2.setup(0, 0, 0, main, (int)mainSize, "MAIN");
+        msx2.setup(0, 0, 4, logo, (int)logoSize, "LOGO");
+        msx2.setup(3, 0, 0, sub, (int)subSize, "SUB");
+        msx2.setupRAM(3, 3);
+        msx2.reset();
+        for (int i = 0; i < 60; i++) {
+            msx2.tick(0, 0, 0);
+        }
+        for (int i = 0; i < (int)sizeof(program); i++) {
+            MSX2::CPUBus::write(&msx2, 0xC000 + i, program[i]);
+        }
+    }
+
+    ~MSX2Fixture()
+    {
+        free(main);
+        free(logo);
+        free(sub);
+    }
+};
+
+// MSX2 memory and I/O accessed through the callbacks (the binding before Z80Template)
+static void MSX2CallbackBusExecute1Frame(benchmark::State& state)
+{
+    MSX2Fixture fixture;
+    Z80 z80([](void* arg, unsigned short addr) { return MSX2::CPUBus::read(arg, addr); }, [](void* arg, unsigned short addr, unsigned char value) { MSX2::CPUBus::write(arg, addr, value); }, [](void* arg, unsigned short port) { return MSX2::CPUBus::in(arg, port); }, [](void* arg, unsigned short port, unsigned char value) { MSX2::CPUBus::out(arg, port, value); }, &fixture.msx2);
+    z80.setConsumeClockCallback([](void* arg, int clocks) {});
+    z80.reg.PC = 0xC000;
+    for (auto _ : state) {
+        z80.execute(CLOCKS_PER_FRAME);
+    }
+}
+
+// MSX2 memory and I/O accessed through the Bus template parameter (same as MSX2::cpu)
+static void MSX2TemplateBusExecute1Frame(benchmark::State& state)
+{
+    MSX2Fixture fixture;
+    Z80Template<MSX2::CPUBus> z80(&fixture.msx2);
+    z80.setConsumeClockCallback([](void* arg, int clocks) {});
+    z80.reg.PC = 0xC000;
+    for (auto _ : state) {
+        z80.execute(CLOCKS_PER_FRAME);
+    }
+}
+
+// C-BIOS running on the whole machine (CPU, VDP and sound) for reference
+static void MSX2Execute1Tick(benchmark::State& state)
+{
+    MSX2Fixture fixture;
+    for (auto _ : state) {
+        fixture.msx2.tick(0, 0, 0);
+    }
+}
+
+BENCHMARK(MSX2CallbackBusExecute1Frame);
+BENCHMARK(MSX2TemplateBusExecute1Frame);
+BENCHMARK(MSX2Execute1Tick);
+BENCHMARK_MAIN();
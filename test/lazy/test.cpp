@@ -0,0 +1,290 @@
+/**
+ * V9958 Lazy Rendering Tester
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#include "../../src/v9958.hpp"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_STEPS 3000
+#define MODES 10
+#define FRAME_DOTS (1368 * 262)
+#define SENTINEL 0xFFFF // not appeared in RGB555
+
+static const struct {
+    const char* name;
+    unsigned char reg[12]; // R#0-R#11 (standard table addresses of the BIOS)
+    bool bitmap;
+} modes[MODES] = {
+    {"GRAPHIC1", {0x00, 0x40, 0x06, 0x80, 0x00, 0x36, 0x07, 0x07, 0x08, 0x00, 0x00, 0x00}, false},
+    {"GRAPHIC2", {0x02, 0x40, 0x06, 0xFF, 0x03, 0x36, 0x07, 0x07, 0x08, 0x00, 0x00, 0x00}, false},
+    {"GRAPHIC3", {0x04, 0x40, 0x06, 0xFF, 0x03, 0x3F, 0x07, 0x07, 0x08, 0x00, 0x00, 0x00}, false},
+    {"GRAPHIC4", {0x06, 0x40, 0x1F, 0x00, 0x00, 0xEF, 0x0F, 0x07, 0x08, 0x00, 0x00, 0x00}, true},
+    {"GRAPHIC5", {0x08, 0x40, 0x1F, 0x00, 0x00, 0xEF, 0x0F, 0x07, 0x08, 0x00, 0x00, 0x00}, true},
+    {"GRAPHIC6", {0x0A, 0x40, 0x1F, 0x00, 0x00, 0xEF, 0x1E, 0x07, 0x08, 0x00, 0x00, 0x01}, true},
+    {"GRAPHIC7", {0x0E, 0x40, 0x1F, 0x00, 0x00, 0xEF, 0x1E, 0x07, 0x08, 0x00, 0x00, 0x01}, true},
+    {"MULTI COLOR", {0x00, 0x48, 0x02, 0x00, 0x00, 0x36, 0x07, 0x07, 0x08, 0x00, 0x00, 0x00}, false},
+    {"TEXT1", {0x00, 0x50, 0x00, 0x00, 0x01, 0x00, 0x00, 0xF4, 0x08, 0x00, 0x00, 0x00}, false},
+    {"TEXT2", {0x04, 0x50, 0x03, 0x2F, 0x01, 0x00, 0x00, 0xF4, 0x08, 0x00, 0x00, 0x00}, false},
+};
+
+static void writeRegister(V9958* vdp, int rn, unsigned char value)
+{
+    vdp->outPort99(value);
+    vdp->outPort99(0x80 | rn);
+}
+
+static void writeVRAM(V9958* vdp, int addr, const unsigned char* data, int size)
+{
+    writeRegister(vdp, 14, (unsigned char)(addr >> 14));
+    vdp->outPort99((unsigned char)(addr & 0xFF));
+    vdp->outPort99((unsigned char)(0x40 | ((addr >> 8) & 0x3F)));
+    for (int i = 0; i < size; i++) {
+        vdp->outPort98(data[i]);
+    }
+}
+
+static void writePalette(V9958* vdp, int pn, unsigned char rb, unsigned char g)
+{
+    writeRegister(vdp, 16, (unsigned char)pn);
+    vdp->outPort9A(rb);
+    vdp->outPort9A(g);
+}
+
+// execute HMMV by the indirect register access (auto increment)
+static void executeHMMV(V9958* vdp, int dx, int dy, int nx, int ny, unsigned char clr)
+{
+    unsigned char regs[11] = {
+        (unsigned char)(dx & 0xFF), (unsigned char)(dx >> 8),
+        (unsigned char)(dy & 0xFF), (unsigned char)(dy >> 8),
+        (unsigned char)(nx & 0xFF), (unsigned char)(nx >> 8),
+        (unsigned char)(ny & 0xFF), (unsigned char)(ny >> 8),
+        clr, 0x00, 0xC0};
+    writeRegister(vdp, 17, 36);
+    for (int i = 0; i < 11; i++) {
+        vdp->outPort9B(regs[i]);
+    }
+}
+
+static void setupMode(V9958* vdp, int mode)
+{
+    vdp->reset();
+    for (int i = 0; i < 12; i++) {
+        writeRegister(vdp, i, modes[mode].reg[i]);
+    }
+}
+
+// apply the same random change (VRAM, registers, palette or command) to both VDPs
+static void changeRandom(V9958* lazy, V9958* full, int mode)
+{
+    static const int hotArea[4] = {0x0000, 0x1800, 0x7400, 0xF000};
+    static unsigned char data[256];
+    int size;
+    int addr;
+    unsigned char rb, g;
+    int rn;
+    unsigned char value;
+    switch (rand() % 16) {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+        case 4:
+        case 5:
+            // VRAM: anywhere or around the tables
+            addr = rand() % 2 ? rand() % 0x20000 : hotArea[rand() % 4] + rand() % 0x1000;
+            size = 1 + rand() % (rand() % 4 ? 8 : 256);
+            for (int i = 0; i < size; i++) {
+                data[i] = (unsigned char)rand();
+            }
+            writeVRAM(lazy, addr, data, size);
+            writeVRAM(full, addr, data, size);
+            break;
+        case 6:
+        case 7:
+            // registers that move the display or change the tables
+            switch (rand() % 9) {
+                case 0: rn = 1; value = (unsigned char)(modes[mode].reg[1] | (rand() & 0b00000011)); break;
+                case 1: rn = 2; value = (unsigned char)(modes[mode].reg[2] ^ (rand() & 0b00100000)); break;
+                case 2: rn = 5; value = (unsigned char)rand(); break;
+                case 3: rn = 7; value = (unsigned char)rand(); break;
+                case 4: rn = 8; value = (unsigned char)(0x08 | (rand() & 0b00000010)); break;
+                case 5: rn = 9; value = (unsigned char)(rand() % 2 ? 0x80 : 0x84); break;
+                case 6: rn = 23; value = (unsigned char)rand(); break;
+                case 7: rn = 25; value = (unsigned char)(rand() & 0b00011011); break;
+                default: rn = 26 + rand() % 2; value = (unsigned char)rand(); break;
+            }
+            writeRegister(lazy, rn, value);
+            writeRegister(full, rn, value);
+            break;
+        case 8:
+            rn = rand() % 16;
+            rb = (unsigned char)rand();
+            g = (unsigned char)rand();
+            writePalette(lazy, rn, rb, g);
+            writePalette(full, rn, rb, g);
+            break;
+        case 9:
+            if (modes[mode].bitmap) {
+                int dx = rand() % 256;
+                int dy = rand() % 1024;
+                int nx = 1 + rand() % 64;
+                int ny = 1 + rand() % 32;
+                value = (unsigned char)rand();
+                executeHMMV(lazy, dx, dy, nx, ny, value);
+                executeHMMV(full, dx, dy, nx, ny, value);
+            }
+            break;
+        default:
+            break; // only ticks
+    }
+}
+
+// number of the scanlines that were re-rendered after the display was filled with SENTINEL (-1: mismatch)
+static int countRenderedLines(V9958* lazy, V9958* full)
+{
+    int count = 0;
+    for (int y = 0; y < 240; y++) {
+        auto line = &lazy->display[y * 568];
+        bool rendered = false;
+        for (int x = 0; x < 568; x++) {
+            if (SENTINEL != line[x]) {
+                rendered = true;
+                break;
+            }
+        }
+        if (rendered) {
+            if (memcmp(line, &full->display[y * 568], 568 * 2)) {
+                return -1;
+            }
+            count++;
+        }
+    }
+    return count;
+}
+
+// settle the line cache and fill the display of the lazy VDP with SENTINEL (re-rendered lines are overwritten)
+static void prepareSentinel(V9958* lazy, V9958* full)
+{
+    lazy->tick(FRAME_DOTS * 2);
+    full->tick(FRAME_DOTS * 2);
+    for (int i = 0; i < 568 * 240; i++) {
+        lazy->display[i] = SENTINEL;
+    }
+}
+
+static bool checkRenderedLines(const char* name, V9958* lazy, V9958* full, int minimum, int maximum)
+{
+    lazy->tick(FRAME_DOTS);
+    full->tick(FRAME_DOTS);
+    int count = countRenderedLines(lazy, full);
+    printf("- %s: %d lines re-rendered", name, count);
+    if (count < minimum || maximum < count) {
+        printf(" ... FAILED (expected %d to %d lines)\n", minimum, maximum);
+        return false;
+    }
+    puts(" ... OK");
+    return true;
+}
+
+int main()
+{
+    static V9958 lazy;
+    static V9958 full;
+    static unsigned char data[0x20000];
+    auto detectInterrupt = [](void*, int) {};
+    auto cancelInterrupt = [](void*) {};
+    auto detectBreak = [](void*) {};
+    lazy.initialize(0, nullptr, detectInterrupt, cancelInterrupt, detectBreak);
+    full.initialize(0, nullptr, detectInterrupt, cancelInterrupt, detectBreak);
+    lazy.lazyRendering = true;
+
+    // the display and the status of the lazy rendering must be same as the full rendering in every screen mode
+    srand(0);
+    for (int mode = 0; mode < MODES; mode++) {
+        setupMode(&lazy, mode);
+        setupMode(&full, mode);
+        for (int i = 0; i < (int)sizeof(data); i++) {
+            data[i] = (unsigned char)rand();
+        }
+        writeVRAM(&lazy, 0, data, sizeof(data));
+        writeVRAM(&full, 0, data, sizeof(data));
+        for (int step = 0; step < TEST_STEPS; step++) {
+            changeRandom(&lazy, &full, mode);
+            int dots = 1 + rand() % (rand() % 4 ? 2000 : FRAME_DOTS);
+            lazy.tick(dots);
+            full.tick(dots);
+            if (memcmp(lazy.display, full.display, sizeof(lazy.display)) || memcmp(lazy.ctx.stat, full.ctx.stat, sizeof(lazy.ctx.stat))) {
+                printf("FAILED (%s, step %d)\n", modes[mode].name, step);
+                return -1;
+            }
+        }
+        printf("%s: OK (%d steps)\n", modes[mode].name, TEST_STEPS);
+    }
+
+    // writing VRAM that is not displayed must not re-render any scanline
+    puts("Re-rendered scanlines:");
+    bool ok = true;
+    memset(data, 0x5A, sizeof(data));
+    setupMode(&lazy, 3);
+    setupMode(&full, 3);
+    prepareSentinel(&lazy, &full);
+    writeVRAM(&lazy, 0x18000, data, 256);
+    writeVRAM(&full, 0x18000, data, 256);
+    ok &= checkRenderedLines("GRAPHIC4: write page 3", &lazy, &full, 0, 0);
+    prepareSentinel(&lazy, &full);
+    executeHMMV(&lazy, 0, 768, 64, 16, 0x77);
+    executeHMMV(&full, 0, 768, 64, 16, 0x77);
+    ok &= checkRenderedLines("GRAPHIC4: HMMV to page 3", &lazy, &full, 0, 0);
+    prepareSentinel(&lazy, &full);
+    writeVRAM(&lazy, 100 * 128 + 5, data, 1);
+    writeVRAM(&full, 100 * 128 + 5, data, 1);
+    ok &= checkRenderedLines("GRAPHIC4: write line 100", &lazy, &full, 1, 2);
+    setupMode(&lazy, 6);
+    setupMode(&full, 6);
+    prepareSentinel(&lazy, &full);
+    writeVRAM(&lazy, 0x10000, data, 256);
+    writeVRAM(&full, 0x10000, data, 256);
+    ok &= checkRenderedLines("GRAPHIC7: write page 1", &lazy, &full, 0, 0);
+    prepareSentinel(&lazy, &full);
+    writeVRAM(&lazy, 50 * 256 + 5, data, 1);
+    writeVRAM(&full, 50 * 256 + 5, data, 1);
+    ok &= checkRenderedLines("GRAPHIC7: write line 50", &lazy, &full, 1, 1);
+    setupMode(&lazy, 0);
+    setupMode(&full, 0);
+    prepareSentinel(&lazy, &full);
+    writeVRAM(&lazy, 0x3000, data, 256);
+    writeVRAM(&full, 0x3000, data, 256);
+    ok &= checkRenderedLines("GRAPHIC1: write unused VRAM", &lazy, &full, 0, 0);
+    prepareSentinel(&lazy, &full);
+    writeVRAM(&lazy, 0x1800 + 32 * 20, data, 1);
+    writeVRAM(&full, 0x1800 + 32 * 20, data, 1);
+    ok &= checkRenderedLines("GRAPHIC1: write name table row 20", &lazy, &full, 1, 191);
+    if (!ok) {
+        return -1;
+    }
+    return 0;
+}
@@ -33,13 +33,72 @@
 #include <fstream>
 #include <vector>
 #include <map>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <sys/stat.h>
 #include "json/json.hpp"
 #include "pngwriter/pngwriter.h"
 #include "../../../src/msx2.hpp"
+#include "../../../src/msx2scaler.hpp"
 
 static std::map<std::string, unsigned char*> biosTable;
 
+// display of a frame handed from the emulation thread to the encoders
+struct Frame {
+    int tick;
+    unsigned int screen[568 * 240]; // XRGB8888 (rendered by the VDP through msx2.setFrameBuffer)
+};
+
+// bounded blocking queue of the frames
+class FrameQueue
+{
+  private:
+    std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    std::deque<Frame*> frames;
+    size_t capacity;
+    bool closed;
+
+  public:
+    FrameQueue(size_t capacity)
+    {
+        this->capacity = capacity;
+        this->closed = false;
+    }
+
+    void push(Frame* frame)
+    {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->notFull.wait(lock, [this] { return this->frames.size() < this->capacity; });
+        this->frames.push_back(frame);
+        this->notEmpty.notify_one();
+    }
+
+    // returns nullptr if the queue is closed and empty
+    Frame* pop()
+    {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->notEmpty.wait(lock, [this] { return !this->frames.empty() || this->closed; });
+        if (this->frames.empty()) {
+            return nullptr;
+        }
+        Frame* frame = this->frames.front();
+        this->frames.pop_front();
+        this->notFull.notify_one();
+        return frame;
+    }
+
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->closed = true;
+        this->notEmpty.notify_all();
+    }
+};
+
 static unsigned char* loadBinaryFile(const char* path, size_t* sizeResult = nullptr)
 {
     FILE* fp = fopen(path, "rb");
@@ -189,12 +248,14 @@ int main(int argc, char* argv[])
         int captureHeight;
         int vidoeWidth;
         int videoHeight;
+        int threads;
     } opt;
     memset(&opt, 0, sizeof(opt));
     opt.settings = "settings.json";
     opt.workdir = ".m2penc";
     opt.captureHeight = 480;
     opt.videoHeight = 480;
+    opt.threads = (int)std::thread::hardware_concurrency();
     bool error = false;
     for (int i = 1; !error && i < argc; i++) {
         if ('-' == argv[i][0]) {
@@ -208,6 +269,7 @@ int main(int argc, char* argv[])
                 case 'w': opt.workdir = argv[i + 1]; break;
                 case 'c': opt.captureHeight = atoi(argv[i + 1]); break;
                 case 'x': opt.videoHeight = atoi(argv[i + 1]); break;
+                case 'j': opt.threads = atoi(argv[i + 1]); break;
                 default: error = true;
             }
             i++;
@@ -226,12 +288,14 @@ int main(int argc, char* argv[])
     if (!error) error = opt.captureHeight != 240 && opt.captureHeight != 480;
     if (!error) error = opt.videoHeight != 240 && opt.videoHeight != 480 && opt.videoHeight != 720 && opt.videoHeight != 960;
     if (!error) error = opt.input.empty();
+    if (opt.threads < 1) opt.threads = 1;
     if (error) {
         puts("usage: m2penc [-o /path/to/output.mp4]");
         puts("              [-s /path/to/settings.json]");
         puts("              [-w /path/to/workdir]");
         puts("              [-c { 240 | 480 }] ............... capture height");
         puts("              [-x { 240 | 480 | 720 | 960 }] ... video height");
+        puts("              [-j threads] ..................... PNG encoder threads");
         puts("              /path/to/playlog.m2p");
         return -1;
     }
@@ -430,30 +494,48 @@ int main(int argc, char* argv[])
     FILE* wav = fopen(wavPath.c_str(), "wb");
     fwrite(&wh, 1, sizeof(wh), wav);
 
+    // the emulation (this thread) renders each frame to a free frame and hands it to the PNG encoder threads through a bounded queue,
+    // and gets the encoded frames back through the free queue to reuse them
+    int queueSize = opt.threads * 2;
+    FrameQueue encodeQueue(queueSize);
+    FrameQueue freeQueue(queueSize + opt.threads);
+    std::vector<Frame*> frames;
+    for (int i = 0; i < queueSize + opt.threads; i++) {
+        frames.push_back(new Frame());
+        freeQueue.push(frames.back());
+    }
+    std::vector<std::thread> encoders;
+    for (int i = 0; i < opt.threads; i++) {
+        encoders.push_back(std::thread([&opt, &encodeQueue, &freeQueue]() {
+            std::vector<unsigned int> screen(568 * 480);
+            int stepX = 568 / opt.captureWidth;
+            Frame* frame;
+            while (nullptr != (frame = encodeQueue.pop())) {
+                // output screen as png (scaled to the capture height, every stepX pixel is plotted)
+                MSX2Scaler::render(frame->screen, 568, 240, 568 * 4, screen.data(), 568 * 4, 1, opt.captureHeight / 240);
+                char pngName[256];
+                snprintf(pngName, sizeof(pngName), "/%08d.png", frame->tick);
+                freeQueue.push(frame);
+                pngwriter png(opt.captureWidth, opt.captureHeight, 0, (opt.workdir + pngName).c_str());
+                for (int y = 0; y < opt.captureHeight; y++) {
+                    const unsigned int* line = &screen[y * 568];
+                    for (int x = 0; x < opt.captureWidth; x++) {
+                        unsigned int rgb = line[x * stepX];
+                        png.plot(x + 1, opt.captureHeight - y, (int)((rgb >> 16) & 0xFF) * 257, (int)((rgb >> 8) & 0xFF) * 257, (int)(rgb & 0xFF) * 257);
+                    }
+                }
+                png.close();
+            }
+        }));
+    }
+
     printf("Writing 0 of %d", pd.tickCount);
     for (int tick = 0; tick < pd.tickCount; tick++) {
+        Frame* frame = freeQueue.pop();
+        frame->tick = tick;
+        msx2.setFrameBuffer(frame->screen, 568 * 4, MSX2_PIXEL_FORMAT_XRGB8888);
         msx2.tick(pd.t1[tick], pd.t2[tick], pd.tk[tick]);
-        // output screen as png
-        unsigned short* display = msx2.getDisplay();
-        char pngName[256];
-        snprintf(pngName, sizeof(pngName), "/%08d.png", tick);
-        pngwriter png(opt.captureWidth, opt.captureHeight, 0, (opt.workdir + pngName).c_str());
-        for (int y = 0; y < 240; y++) {
-            for (int x = 0; x < 568; x++) {
-                unsigned short rgb555 = display[y * 568 + x];
-                double r = ((rgb555 & 0b0111110000000000) >> 10) / 31.0;
-                double g = ((rgb555 & 0b0000001111100000) >> 5) / 31.0;
-                double b = (rgb555 & 0b0000000000011111) / 31.0;
-                if (240 == opt.captureHeight) {
-                    png.plot(x / 2, 240 - y, r, g, b);
-                    x++;
-                } else {
-                    png.plot(x, 480 - y * 2, r, g, b);
-                    png.plot(x, 480 - y * 2 + 1, r, g, b);
-                }
-            }
-        }
-        png.close();
+        encodeQueue.push(frame);
 
         // TODO: output sound as wav
         size_t pcmSize;
@@ -463,6 +545,13 @@ int main(int argc, char* argv[])
         printf("\rWriting frame: %d of %d (%d%%)", 1 + tick, pd.tickCount, (1 + tick) * 100 / pd.tickCount);
         fflush(stdout);
     }
+    encodeQueue.close();
+    for (auto& encoder : encoders) {
+        encoder.join();
+    }
+    for (auto frame : frames) {
+        delete frame;
+    }
     printf(" ... done\n");
     fclose(wav);
 
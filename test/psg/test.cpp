@@ -0,0 +1,157 @@
+/**
+ * AY-3-8910 Renderer Tester
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#include "../../src/ay8910.hpp"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define PSG_CLOCK 1789773
+#define UNIT_CLOCK (PSG_CLOCK / 8)
+#define GAIN 27
+#define MAX_SAMPLES 96000
+
+static short buf[MAX_SAMPLES];
+
+static void writeRegister(AY8910* psg, int rn, unsigned char value)
+{
+    psg->latch(rn);
+    psg->write(value);
+}
+
+// render one second (monaural) and count the rising edges of the output (with hysteresis)
+static int countRisingEdges(AY8910* psg, int rate, int level)
+{
+    psg->render(buf, rate, 1);
+    int result = 0;
+    bool high = false;
+    for (int i = 0; i < rate; i++) {
+        if (!high && level * 3 / 4 < buf[i]) {
+            high = true;
+            result++;
+        } else if (high && buf[i] < level / 4) {
+            high = false;
+        }
+    }
+    return result;
+}
+
+// noise generator of the AY-3-8910 (17 bits LFSR)
+static int getRandom(unsigned int* random)
+{
+    int result = *random & 1;
+    if (result) {
+        *random ^= 0x24000;
+    }
+    *random >>= 1;
+    return result;
+}
+
+int main()
+{
+    const int rates[] = {44100, 48000, 96000};
+    const int maxLevel = 255 * GAIN;
+
+    // tone period: TP = R#0-R#5 (1 cycle = 16 x TP PSG clocks)
+    const int tonePeriods[] = {64, 200, 1000, 4095};
+    for (int r = 0; r < 3; r++) {
+        for (int t = 0; t < 4; t++) {
+            for (int ch = 0; ch < 3; ch++) {
+                AY8910 psg;
+                psg.setClock(PSG_CLOCK, rates[r]);
+                psg.reset(GAIN);
+                writeRegister(&psg, ch * 2, tonePeriods[t] & 0xFF);
+                writeRegister(&psg, ch * 2 + 1, tonePeriods[t] >> 8);
+                writeRegister(&psg, 7, 0b10111111 ^ (1 << ch)); // tone only
+                writeRegister(&psg, 8 + ch, 0x0F);
+                int edges = countRisingEdges(&psg, rates[r], maxLevel);
+                int expect = UNIT_CLOCK / (tonePeriods[t] * 2);
+                if (edges < expect - 1 || expect + 1 < edges) {
+                    printf("FAILED (tone: TP=%d, channel %d at %dHz: %d cycles, expected %d)\n", tonePeriods[t], ch, rates[r], edges, expect);
+                    return -1;
+                }
+            }
+        }
+    }
+    puts("Tone period: OK");
+
+    // noise period: NP = R#6 (the LFSR is clocked every 8 x NP PSG clocks)
+    const int noisePeriods[] = {16, 24, 31};
+    for (int r = 1; r < 3; r++) {
+        for (int n = r == 1 ? 2 : 0; n < 3; n++) {
+            AY8910 psg;
+            psg.setClock(PSG_CLOCK, rates[r]);
+            psg.reset(GAIN);
+            writeRegister(&psg, 6, noisePeriods[n]);
+            writeRegister(&psg, 7, 0b10110111); // noise only (channel A)
+            writeRegister(&psg, 8, 0x0F);
+            int edges = countRisingEdges(&psg, rates[r], maxLevel);
+            unsigned int random = 0xFFFF;
+            int expect = 0;
+            int prev = 0;
+            for (int t = 1; t <= UNIT_CLOCK; t += noisePeriods[n]) {
+                int bit = getRandom(&random);
+                expect += !prev && bit ? 1 : 0;
+                prev = bit;
+            }
+            if (edges < expect - 1 || expect + 1 < edges) {
+                printf("FAILED (noise: NP=%d at %dHz: %d edges, expected %d)\n", noisePeriods[n], rates[r], edges, expect);
+                return -1;
+            }
+        }
+    }
+    puts("Noise period: OK");
+
+    // envelope: the final level of the one-shot shapes and the cycle of the repeating shapes (EP = 16)
+    // one-shot: 0-7, 9, 15 (\___ or /___), 11 (\~~~), 13 (/~~~) / repeating: 8 (\\\\), 10 (\/\/), 12 (////), 14 (/\/\)
+    const int finalLevels[16] = {0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, maxLevel, -1, maxLevel, -1, 0};
+    for (int shape = 0; shape < 16; shape++) {
+        AY8910 psg;
+        psg.setClock(PSG_CLOCK, 44100);
+        psg.reset(GAIN);
+        writeRegister(&psg, 7, 0b10111111); // tone and noise are disabled (the envelope is output as is)
+        writeRegister(&psg, 8, 0x10);
+        writeRegister(&psg, 11, 16);
+        writeRegister(&psg, 12, 0);
+        writeRegister(&psg, 13, shape);
+        int edges = countRisingEdges(&psg, 44100, maxLevel);
+        if (0 <= finalLevels[shape]) {
+            for (int i = 44100 - 1000; i < 44100; i++) {
+                if (buf[i] != finalLevels[shape]) {
+                    printf("FAILED (envelope: shape %d holds %d, expected %d)\n", shape, buf[i], finalLevels[shape]);
+                    return -1;
+                }
+            }
+        } else {
+            int expect = UNIT_CLOCK / (16 * (shape & 0b0010 ? 64 : 32)); // saw: 32 steps, triangle: 64 steps
+            if (edges < expect - 1 || expect + 1 < edges) {
+                printf("FAILED (envelope: shape %d repeats %d times, expected %d)\n", shape, edges, expect);
+                return -1;
+            }
+        }
+    }
+    puts("Envelope: OK");
+    return 0;
+}
@@ -25,6 +25,7 @@
  * -----------------------------------------------------------------------------
  */
 #include "../../src/msx2.hpp"
+#include "../../src/msx2scaler.hpp"
 
 typedef struct BitmapHeader_ {
     int isize;             /* 情報ヘッダサイズ */
@@ -76,20 +77,14 @@ void waitFrames(MSX2* msx2, int frames) {
     }
 }
 
-unsigned char bit5_to_bit8(unsigned char col)
-{
-    unsigned char result = (col & 0b00011111) << 3;
-    result |= (col & 0b10000000) >> 5;
-    result |= (col & 0b01000000) >> 5;
-    result |= (col & 0b00100000) >> 5;
-    return result;
-}
+#define BITMAP_SCREEN_SIZE (14 + 40 + 568 * 480 * 4)
+
+// 画面の描画先（msx2.setFrameBuffer で XRGB8888 形式の外部フレームバッファとして指定）
+static unsigned int screen[568 * 240];
 
-const void* getBitmapScreen(MSX2* msx2, size_t* size) {
-    static unsigned char buf[14 + 40 + 568 * 480 * 4];
-    int iSize = (int)sizeof(buf);
-    *size = iSize;
-    memset(buf, 0, sizeof(buf));
+size_t getBitmapScreen(MSX2* msx2, unsigned char* buf) {
+    int iSize = BITMAP_SCREEN_SIZE;
+    memset(buf, 0, BITMAP_SCREEN_SIZE);
     int ptr = 0;
     buf[ptr++] = 'B';
     buf[ptr++] = 'M';
@@ -113,18 +108,9 @@ const void* getBitmapScreen(MSX2* msx2, size_t* size) {
     header.inum = 0;
     memcpy(&buf[ptr], &header, sizeof(header));
     ptr += sizeof(header);
-    for (int y = 0; y < 240; y++) {
-        for (int x = 0; x < 568; x++) {
-            auto col = msx2->getDisplay()[(239 - y) * 568 + x];
-            buf[ptr++] = bit5_to_bit8(col & 0b0000000000011111);
-            buf[ptr++] = bit5_to_bit8((col & 0b0000001111100000) >> 5);
-            buf[ptr++] = bit5_to_bit8((col & 0b0111110000000000) >> 10);
-            buf[ptr++] = 0x00;
-        }
-        memcpy(&buf[ptr], &buf[ptr - 568 * 4], 568 * 4);
-        ptr += 568 * 4;
-    }
-    return buf;
+    // bottom-up rows of B, G, R, X (= little endian XRGB8888) scaled 2x vertically
+    MSX2Scaler::render(screen, 568, 240, 568 * 4, &buf[ptr + 479 * 568 * 4], -568 * 4, 1, 2);
+    return BITMAP_SCREEN_SIZE;
 }
 
 void typeText(MSX2* msx2, const char* text)
@@ -162,11 +148,12 @@ void trimstring(char* src)
 void writeResultBitmap(MSX2* msx2, const char* output)
 {
     printf("Writing %s...\n", output);
-    size_t bitmapSize;
-    const void* bitmap = getBitmapScreen(msx2, &bitmapSize);
+    unsigned char* bitmap = (unsigned char*)malloc(BITMAP_SCREEN_SIZE);
+    size_t bitmapSize = getBitmapScreen(msx2, bitmap);
     FILE* fp = fopen(output, "wb");
     fwrite(bitmap, 1, bitmapSize, fp);
     fclose(fp);
+    free(bitmap);
 }
 
 int main(int argc, char* argv[])
@@ -280,6 +267,7 @@ int main(int argc, char* argv[])
     }
 
     MSX2 msx2(MSX2_COLOR_MODE_RGB555);
+    msx2.setFrameBuffer(screen, 568 * 4, MSX2_PIXEL_FORMAT_XRGB8888);
     msx2.setupSecondaryExist(false, false, false, true);
     msx2.setupRAM(3, 0);
     msx2.setup(0, 0, 0, msx2p, 0x8000, "MAIN");
@@ -0,0 +1,148 @@
+/**
+ * SCC Block Renderer Tester
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#include "../../src/scc.hpp"
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_ROUNDS 10000
+#define BENCH_SAMPLES (44100 * 60)
+
+static void randomWrite(SCC* scc1, SCC* scc2)
+{
+    unsigned short addr;
+    unsigned char value = (unsigned char)rand();
+    switch (rand() % 4) {
+        case 0: addr = rand() % 0x80; break;        // waveforms
+        case 1: addr = 0x80 + rand() % 0x0A; break; // period
+        case 2: addr = 0x8A + rand() % 0x05; break; // volume
+        default: addr = 0x8F; break;                // channel switch
+    }
+    if (0x80 <= addr && addr < 0x8A && rand() % 2) {
+        value = (unsigned char)(rand() % 100); // short period (multiple steps per sample)
+    }
+    scc1->write(addr, value);
+    scc2->write(addr, value);
+}
+
+int main()
+{
+    static short expect[4096];
+    static short actual[4096];
+    SCC scc1;
+    SCC scc2;
+    scc1.enabled = true;
+    scc2.enabled = true;
+    srand(0);
+    for (int i = 0; i < 0x90; i++) {
+        randomWrite(&scc1, &scc2);
+    }
+#if defined(SCC_SIMD_SSE2)
+    puts("Mixer: SSE2");
+#elif defined(SCC_SIMD_NEON)
+    puts("Mixer: NEON");
+#else
+    puts("Mixer: scalar");
+#endif
+
+    // compare the block renderer with the per sample renderer
+    for (int round = 0; round < TEST_ROUNDS; round++) {
+        int writes = rand() % 4;
+        for (int i = 0; i < writes; i++) {
+            randomWrite(&scc1, &scc2);
+        }
+        int samples = 1 + rand() % 2048;
+        int channels = round & 1 ? 1 : 2; // odd rounds test the monaural mixer
+        for (int i = 0; i < samples * channels; i++) {
+            expect[i] = (short)(rand() % 4 ? rand() % 2048 - 1024 : rand() % 65536 - 32768); // includes saturation
+            actual[i] = expect[i];
+        }
+        for (int i = 0; i < samples; i++) {
+            short right = 0;
+            if (1 == channels) {
+                scc1.tick(&expect[i], &right, scc1.stepCycles());
+            } else {
+                scc1.tick(&expect[i * 2], &expect[i * 2 + 1], scc1.stepCycles());
+            }
+        }
+        scc2.render(actual, samples, channels);
+        if (memcmp(expect, actual, samples * channels * 2) || memcmp(&scc1.ctx, &scc2.ctx, sizeof(scc1.ctx))) {
+            printf("FAILED (round %d, %d samples, %s)\n", round, samples, 1 == channels ? "mono" : "stereo");
+            return -1;
+        }
+    }
+    printf("Bit-exact: OK (%d rounds)\n", TEST_ROUNDS);
+
+    // check that one second of samples steps the waveforms by exactly one second of CPU clocks at each sampling rate
+    const int rates[] = {22050, 44100, 48000, 96000};
+    for (int r = 0; r < 4; r++) {
+        SCC scc;
+        scc.enabled = true;
+        scc.setClock(3584160, rates[r]);
+        for (int i = 0; i < 2; i++) {
+            scc.write(0x80 + i * 2, 0x23); // period = $123
+            scc.write(0x81 + i * 2, 0x01);
+        }
+        scc.write(0x8A, 0x0F); // channel 0 is audible, channel 1 is muted
+        scc.write(0x8F, 0x01);
+        SCC::Context before = scc.ctx;
+        for (int i = 0; i < rates[r]; i += 2048) {
+            scc.render(actual, rates[r] - i < 2048 ? rates[r] - i : 2048);
+        }
+        for (int i = 0; i < 2; i++) {
+            int clocks = before.ch[i].counter + 3584160 - scc.ctx.ch[i].counter;
+            int steps = clocks / 0x123;
+            if (clocks % 0x123 || ((before.ch[i].index + steps) & 0x1F) != scc.ctx.ch[i].index) {
+                printf("FAILED (pitch of channel %d at %dHz)\n", i, rates[r]);
+                return -1;
+            }
+        }
+    }
+    puts("Pitch: OK");
+
+    // measure the time to render 60 seconds
+    for (int i = 0; i < 5; i++) {
+        scc1.write(0x8A + i, 0x0F);
+    }
+    scc1.write(0x8F, 0x1F);
+    memcpy(&scc2.ctx, &scc1.ctx, sizeof(scc1.ctx));
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < BENCH_SAMPLES; i += 2048) {
+        for (int j = 0; j < 2048; j++) {
+            scc1.tick(&expect[j * 2], &expect[j * 2 + 1], scc1.stepCycles());
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    printf("tick: %lldms\n", (long long)std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < BENCH_SAMPLES; i += 2048) {
+        scc2.render(actual, 2048);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    printf("render: %lldms\n", (long long)std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+    return 0;
+}
@@ -0,0 +1,195 @@
+/**
+ * Incremental Snapshot Tester
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#include "../../src/msx2.hpp"
+
+void* loadFile(const char* path, size_t* size)
+{
+    FILE* fp = fopen(path, "rb");
+    if (!fp) {
+        printf("File not found: %s\n", path);
+        return nullptr;
+    }
+    fseek(fp, 0, SEEK_END);
+    *size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    void* result = malloc(*size);
+    if (!result) {
+        puts("No memory");
+        fclose(fp);
+        return nullptr;
+    }
+    if (*size != fread(result, 1, *size, fp)) {
+        printf("Read error: %s\n", path);
+        fclose(fp);
+        free(result);
+        return nullptr;
+    }
+    fclose(fp);
+    return result;
+}
+
+struct Rom {
+    void* data;
+    size_t size;
+} mainRom, logoRom, subRom;
+
+void setup(MSX2* msx2)
+{
+    msx2->setupSecondaryExist(false, false, false, true);
+    msx2->setup(0, 0, 0, mainRom.data, (int)mainRom.size, "MAIN");
+    msx2->setup(0, 0, 4, logoRom.data, (int)logoRom.size, "LOGO");
+    msx2->setup(3, 0, 0, subRom.data, (int)subRom.size, "SUB");
+    msx2->setupRAM(3, 3);
+    msx2->reset();
+}
+
+// rewrite all the 256 bytes pages of RAM and VRAM (compressible, but different from the base)
+// the uncompressed snapshot is larger than the quick save data in this case because of the page numbers
+void rewritePages(MSX2* msx2)
+{
+    for (int i = 0; i < (int)sizeof(msx2->mmu->ram); i++) {
+        msx2->mmu->ram[i] = (unsigned char)(i / 256 + i % 16 + 1);
+    }
+    for (int i = 0; i < (int)sizeof(msx2->vdp->ctx.ram); i++) {
+        msx2->vdp->ctx.ram[i] = (unsigned char)(i / 256 * 3 + i % 8 + 1);
+    }
+    msx2->vdp->resetSpriteCache();
+}
+
+int main()
+{
+    mainRom.data = loadFile("../../msx2-osx/bios/cbios_main_msx2+_jp.rom", &mainRom.size);
+    logoRom.data = loadFile("../../msx2-osx/bios/cbios_logo_msx2+.rom", &logoRom.size);
+    subRom.data = loadFile("../../msx2-osx/bios/cbios_sub.rom", &subRom.size);
+    if (!mainRom.data || !logoRom.data || !subRom.data) {
+        return -1;
+    }
+
+    MSX2 src(0);
+    setup(&src);
+    for (int i = 0; i < 300; i++) {
+        src.tick(0, 0, 0);
+    }
+    size_t baseSize;
+    const void* ptr = src.saveSnapshotBase(&baseSize);
+    if (!ptr) {
+        puts("saveSnapshotBase failed");
+        return -1;
+    }
+    void* base = malloc(baseSize);
+    memcpy(base, ptr, baseSize);
+
+    rewritePages(&src);
+    size_t snapshotSize;
+    ptr = src.saveSnapshot(&snapshotSize);
+    if (!ptr || !snapshotSize) {
+        puts("saveSnapshot failed");
+        return -1;
+    }
+    void* snapshot = malloc(snapshotSize);
+    memcpy(snapshot, ptr, snapshotSize);
+    printf("Base: %d bytes, Snapshot: %d bytes\n", (int)baseSize, (int)snapshotSize);
+
+    MSX2 dst(0);
+    setup(&dst);
+    int error = 0;
+    if (!dst.loadSnapshot(base, baseSize, snapshot, snapshotSize)) {
+        puts("loadSnapshot failed");
+        error++;
+    } else {
+        if (memcmp(src.mmu->ram, dst.mmu->ram, sizeof(src.mmu->ram))) {
+            puts("RAM mismatch");
+            error++;
+        }
+        if (memcmp(&src.vdp->ctx, &dst.vdp->ctx, sizeof(src.vdp->ctx))) {
+            puts("VDP mismatch");
+            error++;
+        }
+        if (memcmp(&src.cpu->reg, &dst.cpu->reg, sizeof(src.cpu->reg))) {
+            puts("Z80 mismatch");
+            error++;
+        }
+    }
+
+    // the quick save of the former PSG emulator (108 bytes context) restores the PSG registers
+    static const unsigned char psgRegs[16] = {0x12, 0x03, 0x34, 0x05, 0x56, 0x07, 0x1A, 0b10110001, 0x0F, 0x10, 0x08, 0x34, 0x12, 0x0E, 0x7F, 0xFF};
+    for (int i = 0; i < 16; i++) {
+        src.psg->latch(i);
+        src.psg->write(psgRegs[i]);
+    }
+    src.psg->latch(7);
+    size_t saveSize;
+    ptr = src.quickSave(&saveSize);
+    static char chunks[0x80000];
+    static char legacy[0x80000];
+    int chunksSize = LZ4_decompress_safe((const char*)ptr, chunks, (int)saveSize, (int)sizeof(chunks));
+    int legacySize = 0;
+    for (int i = 0; 8 <= chunksSize - i;) {
+        int chunkSize;
+        memcpy(&chunkSize, &chunks[i + 4], 4);
+        if (0 == strcmp(&chunks[i], "PSG")) {
+            AY8910::Context* psg = (AY8910::Context*)&chunks[i + 8];
+            char old[108];
+            memset(old, 0, sizeof(old));
+            memcpy(old, psg, offsetof(AY8910::Context, reg) + sizeof(psg->reg));
+            int oldSize = (int)sizeof(old);
+            memcpy(&legacy[legacySize], "PSG", 4);
+            memcpy(&legacy[legacySize + 4], &oldSize, 4);
+            memcpy(&legacy[legacySize + 8], old, sizeof(old));
+            legacySize += 8 + oldSize;
+        } else {
+            memcpy(&legacy[legacySize], &chunks[i], 8 + chunkSize);
+            legacySize += 8 + chunkSize;
+        }
+        i += 8 + chunkSize;
+    }
+    static char compressed[0x80000];
+    int compressedSize = LZ4_compress_default(legacy, compressed, legacySize, (int)sizeof(compressed));
+    MSX2 legacyDst(0);
+    setup(&legacyDst);
+    if (chunksSize <= 0 || !legacyDst.quickLoad(compressed, compressedSize)) {
+        puts("quickLoad (legacy PSG) failed");
+        error++;
+    } else {
+        if (memcmp(src.psg->ctx.reg, legacyDst.psg->ctx.reg, sizeof(src.psg->ctx.reg)) || 7 != legacyDst.psg->ctx.latch) {
+            puts("PSG registers mismatch (legacy PSG)");
+            error++;
+        }
+        if (src.psg->ctx.tPeriod[1] != legacyDst.psg->ctx.tPeriod[1] || src.psg->ctx.ePeriod != legacyDst.psg->ctx.ePeriod) {
+            puts("PSG periods mismatch (legacy PSG)");
+            error++;
+        }
+    }
+    puts(error ? "FAILED" : "OK");
+
+    free(base);
+    free(snapshot);
+    free(mainRom.data);
+    free(logoRom.data);
+    free(subRom.data);
+    return error ? -1 : 0;
+}
@@ -0,0 +1,201 @@
+/**
+ * V9958 Command Engine Tester
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#include "../../src/v9958.hpp"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_ROUNDS 2000
+#define MODES 4
+#define MAX_DOTS 2000000
+
+static const struct {
+    const char* name;
+    unsigned char reg0;
+    int width;
+} modes[MODES] = {
+    {"GRAPHIC4", 0b00000110, 256},
+    {"GRAPHIC5", 0b00001000, 512},
+    {"GRAPHIC6", 0b00001010, 512},
+    {"GRAPHIC7", 0b00001110, 256},
+};
+
+static const struct {
+    const char* name;
+    unsigned char cmd;
+    bool logical;
+} commands[] = {
+    {"HMMM", 0b11010000, false},
+    {"HMMV", 0b11000000, false},
+    {"LMMM", 0b10010000, true},
+    {"LMMV", 0b10000000, true},
+    {"LINE", 0b01110000, true},
+};
+
+static const unsigned char logicalOperations[] = {0, 1, 2, 3, 4, 8, 9, 10, 11, 12};
+
+static unsigned long long fnv(const void* data, size_t size, unsigned long long h = 14695981039346656037ULL)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        h ^= p[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+static void writeRegister(V9958* vdp, int rn, unsigned char value)
+{
+    vdp->outPort99(value);
+    vdp->outPort99(0x80 | rn);
+}
+
+// X coordinate that often starts at (or beyond) either edge of the screen
+static int randomX(int width)
+{
+    switch (rand() % 4) {
+        case 0: return rand() % 8;
+        case 1: return (width - 8 + rand() % 16) & 0x1FF;
+        case 2: return width + rand() % (512 - width + 1) & 0x1FF;
+        default: return rand() % 512;
+    }
+}
+
+// executes a random command by the port writes and returns the hash of the status polled by the CPU and the result
+static unsigned long long executeRandomCommand(V9958* vdp, int mode, int* commandIndex)
+{
+    int width = modes[mode].width;
+    int sx = randomX(width);
+    int dx = randomX(width);
+    int sy = rand() % 1024;
+    int dy = rand() % 1024;
+    int nx = rand() % 4 ? rand() % 64 : rand() % 512;
+    int ny = 1 + rand() % 8;
+    unsigned char arg = (unsigned char)(rand() & 0b00001101);
+    *commandIndex = rand() % (int)(sizeof(commands) / sizeof(commands[0]));
+    unsigned char cmd = commands[*commandIndex].cmd;
+    if (commands[*commandIndex].logical) {
+        cmd |= logicalOperations[rand() % sizeof(logicalOperations)];
+    }
+
+    // R#32-R#46 are written with the indirect register access (auto increment)
+    unsigned char regs[15] = {
+        (unsigned char)(sx & 0xFF), (unsigned char)(sx >> 8),
+        (unsigned char)(sy & 0xFF), (unsigned char)(sy >> 8),
+        (unsigned char)(dx & 0xFF), (unsigned char)(dx >> 8),
+        (unsigned char)(dy & 0xFF), (unsigned char)(dy >> 8),
+        (unsigned char)(nx & 0xFF), (unsigned char)(nx >> 8),
+        (unsigned char)(ny & 0xFF), (unsigned char)(ny >> 8),
+        (unsigned char)rand(), arg, cmd};
+    writeRegister(vdp, 17, 32);
+    for (int i = 0; i < 15; i++) {
+        vdp->outPort9B(regs[i]);
+    }
+
+    // poll S#2 at random intervals until the command ends (CE timing and the command progress are visible to the CPU)
+    unsigned long long h = fnv(regs, sizeof(regs));
+    writeRegister(vdp, 15, 2);
+    for (int dots = 0; dots < MAX_DOTS;) {
+        int n = 1 + rand() % (rand() % 8 ? 64 : 4096);
+        vdp->tick(n);
+        dots += n;
+        unsigned char s2 = vdp->inPort99() & 0b10000001; // TR and CE
+        h = fnv(&s2, 1, h);
+        h = fnv(&vdp->ctx.cmd, sizeof(vdp->ctx.cmd), h);
+        if (0 == (s2 & 0b00000001)) {
+            break;
+        }
+    }
+    writeRegister(vdp, 15, 0);
+    h = fnv(&vdp->ctx.reg[32], 15, h);
+    return fnv(vdp->ctx.ram, sizeof(vdp->ctx.ram), h);
+}
+
+int main(int argc, char* argv[])
+{
+    static V9958 vdp;
+    static unsigned long long hash[MODES][TEST_ROUNDS];
+    static int commandIndex[MODES][TEST_ROUNDS];
+    if (argc < 2) {
+        puts("usage: test {record|verify} expect.bin");
+        return 1;
+    }
+    bool record = 0 == strcmp(argv[1], "record");
+    const char* path = 2 < argc ? argv[2] : "expect.bin";
+#ifdef V9958_DISABLE_COMMAND_SPAN
+    puts("Command engine: per-step");
+#else
+    puts("Command engine: span");
+#endif
+
+    // execute random commands in every bitmap mode
+    srand(0);
+    vdp.initialize(0, nullptr, [](void*, int) {}, [](void*) {}, [](void*) {});
+    vdp.skipRendering = true;
+    for (int mode = 0; mode < MODES; mode++) {
+        writeRegister(&vdp, 0, modes[mode].reg0);
+        writeRegister(&vdp, 1, 0b01000000);
+        for (int round = 0; round < TEST_ROUNDS; round++) {
+            if (0 == round % 100) {
+                for (int i = 0; i < (int)sizeof(vdp.ctx.ram); i++) {
+                    vdp.ctx.ram[i] = (unsigned char)rand();
+                }
+            }
+            hash[mode][round] = executeRandomCommand(&vdp, mode, &commandIndex[mode][round]);
+        }
+    }
+
+    // record (per-step execution) or verify (span execution) the result
+    FILE* fp = fopen(path, record ? "wb" : "rb");
+    if (!fp) {
+        printf("cannot open %s\n", path);
+        return -1;
+    }
+    if (record) {
+        fwrite(hash, 1, sizeof(hash), fp);
+        fclose(fp);
+        printf("Recorded: %s (%d rounds)\n", path, TEST_ROUNDS);
+    } else {
+        static unsigned long long expect[MODES][TEST_ROUNDS];
+        size_t readSize = fread(expect, 1, sizeof(expect), fp);
+        fclose(fp);
+        if (readSize != sizeof(expect)) {
+            printf("invalid %s\n", path);
+            return -1;
+        }
+        for (int mode = 0; mode < MODES; mode++) {
+            for (int round = 0; round < TEST_ROUNDS; round++) {
+                if (hash[mode][round] != expect[mode][round]) {
+                    printf("FAILED (%s, %s, round %d)\n", modes[mode].name, commands[commandIndex[mode][round]].name, round);
+                    return -1;
+                }
+            }
+        }
+        printf("Step-exact: OK (%d rounds)\n", TEST_ROUNDS);
+    }
+    return 0;
+}
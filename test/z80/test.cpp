@@ -0,0 +1,191 @@
+/**
+ * Z80 Dispatch Tester
+ * -----------------------------------------------------------------------------
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Yoji Suzuki.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ * -----------------------------------------------------------------------------
+ */
+#include "../../src/z80.hpp"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_ROUNDS 20000
+
+static struct Machine {
+    Z80* cpu;
+    unsigned char ram[0x10000];
+    unsigned long long hash; // hash of the bus accesses and the callbacks
+    int clocks;
+} machine;
+
+static unsigned long long fnv(const void* data, size_t size, unsigned long long h = 14695981039346656037ULL)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        h ^= p[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+static void record(int tag, int value)
+{
+    int event[2] = {tag, value};
+    machine.hash = fnv(event, sizeof(event), machine.hash);
+}
+
+static void initializeMachine()
+{
+    // random instructions (a half of them are prefixed to execute CB, DD, ED, FD, DDCB and FDCB operands well)
+    static const unsigned char prefixes[] = {0xCB, 0xDD, 0xED, 0xFD};
+    for (int addr = 0; addr < (int)sizeof(machine.ram);) {
+        switch (rand() % 8) {
+            case 0:
+            case 1:
+            case 2:
+                machine.ram[addr++ & 0xFFFF] = (unsigned char)rand();
+                break;
+            case 3:
+            case 4:
+            case 5:
+                machine.ram[addr++ & 0xFFFF] = prefixes[rand() % 4];
+                machine.ram[addr++ & 0xFFFF] = (unsigned char)rand();
+                break;
+            default:
+                machine.ram[addr++ & 0xFFFF] = rand() % 2 ? 0xDD : 0xFD;
+                machine.ram[addr++ & 0xFFFF] = 0xCB;
+                machine.ram[addr++ & 0xFFFF] = (unsigned char)rand();
+                machine.ram[addr++ & 0xFFFF] = (unsigned char)rand();
+                break;
+        }
+    }
+    unsigned char* r = (unsigned char*)&machine.cpu->reg;
+    for (int i = 0; i < (int)sizeof(machine.cpu->reg); i++) {
+        r[i] = (unsigned char)rand();
+    }
+    machine.cpu->reg.IFF &= 0b00011111; // not halted and no pending IRQ/NMI
+    machine.cpu->reg.interrupt = rand() % 3;
+    machine.cpu->reg.consumeClockCounter = 0;
+    machine.cpu->reg.execEI = 0;
+}
+
+int main(int argc, char* argv[])
+{
+    static unsigned long long hash[TEST_ROUNDS];
+    if (argc < 2) {
+        puts("usage: test {record|verify} expect.bin");
+        return 1;
+    }
+    bool isRecord = 0 == strcmp(argv[1], "record");
+    const char* path = 2 < argc ? argv[2] : "expect.bin";
+#ifdef Z80_THREADED_DISPATCH
+    puts("Dispatch: threaded");
+#else
+    puts("Dispatch: table");
+#endif
+
+    // execute random bytes with random registers, interrupts and break requests
+    srand(0);
+    Z80 cpu([](void* arg, unsigned short addr) {
+            record(1, addr);
+            return ((Machine*)arg)->ram[addr]; }, [](void* arg, unsigned short addr, unsigned char value) {
+            record(2, addr << 8 | value);
+            ((Machine*)arg)->ram[addr] = value; }, [](void* arg, unsigned short port) {
+            record(3, port);
+            return (unsigned char)(port * 37 + ((Machine*)arg)->clocks); }, [](void* arg, unsigned short port, unsigned char value) { record(4, port << 8 | value); }, &machine, true);
+    machine.cpu = &cpu;
+    cpu.setConsumeClockCallback([](void* arg, int clocks) {
+        Machine* m = (Machine*)arg;
+        record(5, clocks);
+        m->clocks += clocks;
+        if (0 == m->clocks % 97) m->cpu->requestBreak();
+    });
+#ifndef Z80_DISABLE_BREAKPOINT
+    for (int i = 0; i < 64; i++) {
+        cpu.addBreakPoint((unsigned short)rand(), [](void* arg) {
+            Machine* m = (Machine*)arg;
+            record(6, m->cpu->reg.PC);
+            if (m->clocks & 1) m->cpu->requestBreak();
+        });
+    }
+    auto breakOperand = [](void* arg, unsigned char* opcode, int length) {
+        record(7, length);
+        machine.hash = fnv(opcode, length, machine.hash);
+        if (machine.clocks & 2) machine.cpu->requestBreak();
+    };
+    cpu.addBreakOperand(0x76, breakOperand);                                   // HALT
+    cpu.addBreakOperand(0xCB, 0x06, breakOperand);                             // RLC (HL)
+    cpu.addBreakOperand(0xED, 0xB0, breakOperand);                             // LDIR
+    cpu.addBreakOperand(0xDD, 0x21, breakOperand);                             // LD IX, nn
+    cpu.addBreakOperand(0xFD, 0xE9, breakOperand);                             // JP (IY)
+    cpu.addBreakOperand((unsigned char)0xDD, 0xCB, 0x06, breakOperand);        // RLC (IX+d)
+    cpu.addBreakOperand((unsigned char)0xFD, 0xCB, 0xC6, breakOperand);        // SET 0, (IY+d)
+#endif
+    for (int round = 0; round < TEST_ROUNDS; round++) {
+        if (0 == round % 100) {
+            initializeMachine();
+        }
+        switch (rand() % 16) {
+            case 0: cpu.generateIRQ((unsigned char)rand()); break;
+            case 1: cpu.generateNMI((unsigned short)rand()); break;
+        }
+        int executed;
+        try {
+            executed = cpu.execute(1 + rand() % 512);
+        } catch (std::runtime_error& e) {
+            machine.hash = fnv(e.what(), strlen(e.what()), machine.hash);
+            executed = -1;
+            cpu.reg.consumeClockCounter = 0;
+        }
+        record(8, executed);
+        hash[round] = fnv(&cpu.reg, sizeof(cpu.reg), machine.hash);
+    }
+
+    // record (table dispatch) or verify (threaded dispatch) the result
+    FILE* fp = fopen(path, isRecord ? "wb" : "rb");
+    if (!fp) {
+        printf("cannot open %s\n", path);
+        return -1;
+    }
+    if (isRecord) {
+        fwrite(hash, 1, sizeof(hash), fp);
+        fclose(fp);
+        printf("Recorded: %s (%d rounds)\n", path, TEST_ROUNDS);
+    } else {
+        static unsigned long long expect[TEST_ROUNDS];
+        size_t readSize = fread(expect, 1, sizeof(expect), fp);
+        fclose(fp);
+        if (readSize != sizeof(expect)) {
+            printf("invalid %s\n", path);
+            return -1;
+        }
+        for (int round = 0; round < TEST_ROUNDS; round++) {
+            if (hash[round] != expect[round]) {
+                printf("FAILED (round %d)\n", round);
+                return -1;
+            }
+        }
+        printf("Table-exact: OK (%d rounds)\n", TEST_ROUNDS);
+    }
+    return 0;
+}
@@ -0,0 +1,253 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+// generates Z80::executeThreaded (computed-goto threaded dispatch) from the operand tables of z80.hpp and
+// replaces the lines between BEGIN_MARK and END_MARK of z80.hpp with it
+
+#define BEGIN_MARK "    // BEGIN: generated by tools/z80threaded"
+#define END_MARK "    // END: generated by tools/z80threaded"
+
+struct Table {
+    const char* declaration; // declaration of the operand table in z80.hpp
+    const char* prefix;      // prefix of the labels
+    const char* unknown;     // prefix bytes of the unknown operand message
+    const char* checkBreak;  // checkBreakOperand function of the table
+    const char* args;        // arguments of the handlers
+    std::vector<std::string> handlers;
+};
+
+static Table tables[] = {
+    {"void (*opSet1[256])(Z80* ctx) = {", "OP1", "", "checkBreakOperand", "this"},
+    {"void (*opSetCB[256])(Z80* ctx) = {", "CB", "CB", "checkBreakOperandCB", "this"},
+    {"void (*opSetED[256])(Z80* ctx) = {", "ED", "ED", "checkBreakOperandED", "this"},
+    {"void (*opSetIX[256])(Z80* ctx) = {", "IX", "DD", "checkBreakOperandIX", "this"},
+    {"void (*opSetIY[256])(Z80* ctx) = {", "IY", "FD", "checkBreakOperandIY", "this"},
+    {"void (*opSetIX4[256])(Z80* ctx, signed char d) = {", "IX4", "DD,CB", "checkBreakOperandIX4", "this, d"},
+    {"void (*opSetIY4[256])(Z80* ctx, signed char d) = {", "IY4", "FD,CB", "checkBreakOperandIY4", "this, d"},
+};
+
+static const int tableCount = (int)(sizeof(tables) / sizeof(tables[0]));
+
+static bool parseTable(const std::string& source, Table* table)
+{
+    size_t start = source.find(table->declaration);
+    if (start == std::string::npos) return false;
+    start += strlen(table->declaration);
+    size_t end = source.find("};", start);
+    if (end == std::string::npos) return false;
+    std::string name;
+    for (size_t i = start; i <= end; i++) {
+        char c = source[i];
+        if (c == ',' || c == '}') {
+            if (name.empty()) return false;
+            table->handlers.push_back(name);
+            name.clear();
+        } else if (c == '_' || ('0' <= c && c <= '9') || ('A' <= c && c <= 'Z') || ('a' <= c && c <= 'z')) {
+            name += c;
+        }
+    }
+    if (256 < table->handlers.size()) return false;
+    while (table->handlers.size() < 256) {
+        table->handlers.push_back("nullptr"); // not initialized
+    }
+    return true;
+}
+
+static std::string labelOf(const Table* table, const std::string& handler)
+{
+    return std::string(table->prefix) + "_" + (handler == "nullptr" ? "UNKNOWN" : handler);
+}
+
+// prefix operands decoded in place (the next table to dispatch)
+static const char* prefixTableOf(const Table* table, const std::string& handler)
+{
+    if (0 == strcmp(table->prefix, "OP1")) {
+        if (handler == "OP_CB") return "CB";
+        if (handler == "OP_ED") return "ED";
+        if (handler == "OP_IX") return "IX";
+        if (handler == "OP_IY") return "IY";
+    } else if (0 == strcmp(table->prefix, "IX") && handler == "OP_IX4") {
+        return "IX4";
+    } else if (0 == strcmp(table->prefix, "IY") && handler == "OP_IY4") {
+        return "IY4";
+    }
+    return nullptr;
+}
+
+static void generateLabelTable(std::string& out, const Table* table)
+{
+    out += "        static const void* const label";
+    out += table->prefix;
+    out += "[256] = {\n";
+    for (int i = 0; i < 256; i++) {
+        if (0 == i % 8) out += "            ";
+        out += "&&" + labelOf(table, table->handlers[i]);
+        out += i == 255 ? "};\n" : (7 == i % 8 ? ",\n" : ", ");
+    }
+}
+
+static void generateLabels(std::string& out, const Table* table)
+{
+    std::vector<std::string> done;
+    for (int i = 0; i < 256; i++) {
+        const std::string& handler = table->handlers[i];
+        bool duplicated = false;
+        for (auto& d : done) {
+            if (d == handler) duplicated = true;
+        }
+        if (duplicated) continue;
+        done.push_back(handler);
+        out += "    " + labelOf(table, handler) + ":\n";
+        if (handler == "nullptr") {
+            out += "#ifndef Z80_NO_EXCEPTION\n";
+            out += "        {\n";
+            out += "            char buf[80];\n";
+            out += std::string("            snprintf(buf, sizeof(buf), \"detect an unknown operand (") + table->unknown + ",%02X)\", operandNumber);\n";
+            out += "            throw std::runtime_error(buf);\n";
+            out += "        }\n";
+            out += "#endif\n";
+            out += "        Z80_THREADED_NEXT();\n";
+            continue;
+        }
+        if (0 != strcmp(table->prefix, "OP1")) {
+            out += std::string("        Z80_THREADED_BREAK_OPERAND(") + table->checkBreak + "(operandNumber));\n";
+        }
+        const char* next = prefixTableOf(table, handler);
+        if (next) {
+            if (0 == strcmp(next, "IX4") || 0 == strcmp(next, "IY4")) {
+                out += "        d = (signed char)fetch(4);\n";
+                out += "        operandNumber = fetch(4);\n";
+            } else {
+                out += "        operandNumber = fetch(4 + wtc.fetchM);\n";
+            }
+            out += std::string("        goto* label") + next + "[operandNumber];\n";
+        } else {
+            out += "        " + handler + "(" + table->args + ");\n";
+            out += "        Z80_THREADED_NEXT();\n";
+        }
+    }
+}
+
+static std::string generate()
+{
+    std::string out;
+    out += BEGIN_MARK " (do not edit)\n";
+    out += "#ifdef Z80_THREADED_DISPATCH\n";
+    out += "#ifndef Z80_DISABLE_BREAKPOINT\n";
+    out += "#define Z80_THREADED_BREAK_POINT() checkBreakPoint()\n";
+    out += "#define Z80_THREADED_BREAK_OPERAND(check) check\n";
+    out += "#else\n";
+    out += "#define Z80_THREADED_BREAK_POINT()\n";
+    out += "#define Z80_THREADED_BREAK_OPERAND(check)\n";
+    out += "#endif\n";
+    out += "#ifdef Z80_CALLBACK_PER_INSTRUCTION\n";
+    out += "#ifdef Z80_CALLBACK_WITHOUT_CHECK\n";
+    out += "#define Z80_THREADED_END_INSTRUCTION() \\\n";
+    out += "    checkInterrupt();                  \\\n";
+    out += "    CB.consumeClock(CB.arg, reg.consumeClockCounter); \\\n";
+    out += "    reg.consumeClockCounter = 0\n";
+    out += "#else\n";
+    out += "#define Z80_THREADED_END_INSTRUCTION()                                          \\\n";
+    out += "    checkInterrupt();                                                           \\\n";
+    out += "    if (CB.consumeClockEnabled) CB.consumeClock(CB.arg, reg.consumeClockCounter); \\\n";
+    out += "    reg.consumeClockCounter = 0\n";
+    out += "#endif\n";
+    out += "#else\n";
+    out += "#define Z80_THREADED_END_INSTRUCTION() \\\n";
+    out += "    reg.consumeClockCounter = 0;       \\\n";
+    out += "    checkInterrupt()\n";
+    out += "#endif\n";
+    out += "// fetch the next operand and jump to its handler (every handler has its own indirect jump)\n";
+    out += "#define Z80_THREADED_DISPATCH_NEXT()         \\\n";
+    out += "    if (reg.IFF & IFF_HALT()) goto HALTED;   \\\n";
+    out += "    if (wtc.fetch) consumeClock(wtc.fetch);  \\\n";
+    out += "    Z80_THREADED_BREAK_POINT();              \\\n";
+    out += "    reg.execEI = 0;                          \\\n";
+    out += "    operandNumber = fetch(2);                \\\n";
+    out += "    updateRefreshRegister();                 \\\n";
+    out += "    Z80_THREADED_BREAK_OPERAND(checkBreakOperand(operandNumber)); \\\n";
+    out += "    goto* labelOP1[operandNumber]\n";
+    out += "// finish the executed instruction (same as the loop of execute) and dispatch the next operand\n";
+    out += "#define Z80_THREADED_NEXT()                          \\\n";
+    out += "    executed += reg.consumeClockCounter;             \\\n";
+    out += "    clock -= reg.consumeClockCounter;                \\\n";
+    out += "    Z80_THREADED_END_INSTRUCTION();                  \\\n";
+    out += "    if (clock <= 0 || requestBreakFlag) return executed; \\\n";
+    out += "    Z80_THREADED_DISPATCH_NEXT()\n";
+    out += "\n";
+    out += "    // same as execute(int) but each operand handler is called directly and jumps to the next handler by computed goto\n";
+    out += "    inline int executeThreaded(int clock)\n";
+    out += "    {\n";
+    for (int i = 0; i < tableCount; i++) {
+        generateLabelTable(out, &tables[i]);
+    }
+    out += "        int executed = 0;\n";
+    out += "        unsigned char operandNumber;\n";
+    out += "        signed char d;\n";
+    out += "        requestBreakFlag = false;\n";
+    out += "        reg.consumeClockCounter = 0;\n";
+    out += "        if (clock <= 0) return 0;\n";
+    out += "        Z80_THREADED_DISPATCH_NEXT();\n";
+    out += "    HALTED:\n";
+    out += "        // execute NOP while halt\n";
+    out += "        reg.execEI = 0;\n";
+    out += "        readByte(reg.PC); // NOTE: read and discard (to be consumed 4Hz)\n";
+    out += "        Z80_THREADED_NEXT();\n";
+    for (int i = 0; i < tableCount; i++) {
+        generateLabels(out, &tables[i]);
+    }
+    out += "    }\n";
+    out += "#undef Z80_THREADED_NEXT\n";
+    out += "#undef Z80_THREADED_DISPATCH_NEXT\n";
+    out += "#undef Z80_THREADED_END_INSTRUCTION\n";
+    out += "#undef Z80_THREADED_BREAK_OPERAND\n";
+    out += "#undef Z80_THREADED_BREAK_POINT\n";
+    out += "#endif\n";
+    out += END_MARK "\n";
+    return out;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2) {
+        fprintf(stderr, "z80threaded /path/to/z80.hpp\n");
+        return -1;
+    }
+    FILE* fp = fopen(argv[1], "rb");
+    if (!fp) {
+        fprintf(stderr, "file open error\n");
+        return -1;
+    }
+    std::string source;
+    char buf[4096];
+    size_t readSize;
+    while (0 < (readSize = fread(buf, 1, sizeof(buf), fp))) {
+        source.append(buf, readSize);
+    }
+    fclose(fp);
+    for (int i = 0; i < tableCount; i++) {
+        if (!parseTable(source, &tables[i])) {
+            fprintf(stderr, "operand table not found: %s\n", tables[i].declaration);
+            return -1;
+        }
+    }
+    size_t begin = source.find(BEGIN_MARK);
+    size_t end = source.find(END_MARK);
+    if (begin == std::string::npos || end == std::string::npos || end < begin) {
+        fprintf(stderr, "generated block not found\n");
+        return -1;
+    }
+    end = source.find('\n', end) + 1;
+    source.replace(begin, end - begin, generate());
+    fp = fopen(argv[1], "wb");
+    if (!fp) {
+        fprintf(stderr, "file open error\n");
+        return -1;
+    }
+    fwrite(source.data(), 1, source.size(), fp);
+    fclose(fp);
+    return 0;
+}